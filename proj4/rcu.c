@@ -0,0 +1,169 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by Kim Taehyeon (2019061658 컴퓨터학부 김태현) (26.10.19)
+#include <sched.h>
+#include <stdlib.h>
+#include "rcu.h"
+
+int rcu_init(rcu_t *rcu)
+{
+    atomic_init(&rcu->gp, 1);
+    rcu->readers = NULL;
+    rcu->pending = NULL;
+    rcu->npending = 0;
+    if (pthread_mutex_init(&rcu->mutex, NULL) != 0)
+        return RCU_FAIL;
+    return RCU_SUCCESS;
+}
+
+/*
+ * 미뤄 둔 옛 버전을 모두 지우고 자원을 돌려준다. 등록된 reader가 남아 있으면 RCU_FAIL을 돌려준다.
+ */
+int rcu_destroy(rcu_t *rcu)
+{
+    if (rcu->readers != NULL)
+        return RCU_FAIL;
+    rcu_barrier(rcu);
+    pthread_mutex_destroy(&rcu->mutex);
+    return RCU_SUCCESS;
+}
+
+/*
+ * 부른 스레드를 reader로 등록하고 online 상태로 만든다. 돌려받은 기록은 그 스레드만 써야 한다.
+ */
+rcu_reader_t *rcu_register(rcu_t *rcu)
+{
+    rcu_reader_t *r;
+
+    if ((r = aligned_alloc(RCU_CACHELINE, sizeof(rcu_reader_t))) == NULL)
+        return NULL;
+    r->rcu = rcu;
+    pthread_mutex_lock(&rcu->mutex);
+    atomic_init(&r->qs, atomic_load(&rcu->gp));
+    r->next = rcu->readers;
+    rcu->readers = r;
+    pthread_mutex_unlock(&rcu->mutex);
+    return r;
+}
+
+/*
+ * reader 등록을 푼다. 먼저 offline이 되어야 mutex를 쥐고 기다리는 rcu_synchronize()와 엇갈려 멈추지 않는다.
+ */
+void rcu_unregister(rcu_reader_t *r)
+{
+    rcu_t *rcu = r->rcu;
+    rcu_reader_t **p;
+
+    rcu_offline(r);
+    pthread_mutex_lock(&rcu->mutex);
+    for (p = &rcu->readers; *p != r; p = &(*p)->next)
+        ;
+    *p = r->next;
+    pthread_mutex_unlock(&rcu->mutex);
+    free(r);
+}
+
+/*
+ * 공유 데이터를 가리키는 포인터를 하나도 들고 있지 않을 때 부른다. 자기 캐시 라인에 현재 gp를 적기만 한다.
+ */
+void rcu_quiescent(rcu_reader_t *r)
+{
+    atomic_store_explicit(&r->qs, atomic_load_explicit(&r->rcu->gp, memory_order_acquire),
+                          memory_order_release);
+}
+
+/*
+ * 오래 잠들거나 기다리기 전에 offline이 된다. offline인 동안은 공유 데이터를 읽으면 안 된다.
+ */
+void rcu_offline(rcu_reader_t *r)
+{
+    atomic_store_explicit(&r->qs, 0, memory_order_release);
+}
+
+/*
+ * 다시 online이 된다. writer가 gp를 올리는 것과 엇갈려도 서로를 보도록 seq_cst로 적고 읽는다.
+ */
+void rcu_online(rcu_reader_t *r)
+{
+    atomic_store_explicit(&r->qs, atomic_load_explicit(&r->rcu->gp, memory_order_seq_cst),
+                          memory_order_seq_cst);
+}
+
+/*
+ * mutex를 쥔 채 grace period 하나를 끝낸다. gp를 올린 뒤, online인 reader가 모두 새 gp 이상을 적을 때까지 기다린다.
+ * 새 gp를 적은 reader는 그 전에 읽은 옛 포인터를 더는 쓰지 않는다.
+ */
+static void synchronize_locked(rcu_t *rcu)
+{
+    uint64_t gp = atomic_fetch_add_explicit(&rcu->gp, 1, memory_order_seq_cst) + 1;
+    uint64_t qs;
+
+    for (rcu_reader_t *r = rcu->readers; r != NULL; r = r->next)
+        while ((qs = atomic_load_explicit(&r->qs, memory_order_seq_cst)) != 0 && qs < gp)
+            sched_yield();
+}
+
+/*
+ * 이 함수를 부르기 전에 내보낸 포인터를 읽던 reader가 모두 quiescent 상태를 지날 때까지 기다린다.
+ * reader로 등록된 스레드가 부르려면 먼저 offline이 되어야 한다.
+ */
+void rcu_synchronize(rcu_t *rcu)
+{
+    pthread_mutex_lock(&rcu->mutex);
+    synchronize_locked(rcu);
+    pthread_mutex_unlock(&rcu->mutex);
+}
+
+/*
+ * mutex를 쥔 채 미뤄 둔 옛 버전을 grace period 하나가 끝난 뒤에 모두 지운다.
+ */
+static void reclaim_locked(rcu_t *rcu)
+{
+    struct rcu_retired *list = rcu->pending, *next;
+
+    if (list == NULL)
+        return;
+    rcu->pending = NULL;
+    rcu->npending = 0;
+    synchronize_locked(rcu);
+    for (; list != NULL; list = next) {
+        next = list->next;
+        list->free_fn(list->ptr);
+        free(list);
+    }
+}
+
+/*
+ * rcu_assign_pointer()로 바꿔치기한 옛 버전을 넘긴다. 바로 지우지 않고 모아 두었다가
+ * RCU_BATCH개가 되면 grace period 하나로 한꺼번에 지운다.
+ */
+int rcu_retire(rcu_t *rcu, void *ptr, void (*free_fn)(void *ptr))
+{
+    struct rcu_retired *node;
+
+    if ((node = (struct rcu_retired *)malloc(sizeof(struct rcu_retired))) == NULL)
+        return RCU_FAIL;
+    node->ptr = ptr;
+    node->free_fn = free_fn;
+    pthread_mutex_lock(&rcu->mutex);
+    node->next = rcu->pending;
+    rcu->pending = node;
+    if (++rcu->npending >= RCU_BATCH)
+        reclaim_locked(rcu);
+    pthread_mutex_unlock(&rcu->mutex);
+    return RCU_SUCCESS;
+}
+
+/*
+ * 지금까지 넘긴 옛 버전을 모두 지울 때까지 기다린다.
+ */
+void rcu_barrier(rcu_t *rcu)
+{
+    pthread_mutex_lock(&rcu->mutex);
+    reclaim_locked(rcu);
+    pthread_mutex_unlock(&rcu->mutex);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by Kim Taehyeon (2019061658 컴퓨터학부 김태현) (26.10.19)
+#ifndef _RCU_H_
+#define _RCU_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+#define RCU_SUCCESS 0
+#define RCU_FAIL 1
+#define RCU_BATCH 64
+#define RCU_CACHELINE 64
+
+/*
+ * 공유 포인터를 읽고 바꾸는 매크로이다. writer는 새 버전을 다 만든 뒤 rcu_assign_pointer()로 내보내고,
+ * reader는 rcu_dereference()로 읽은 포인터를 다음 quiescent 상태 전까지만 쓴다.
+ */
+#define rcu_dereference(p) __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+#define rcu_assign_pointer(p, v) __atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+
+/*
+ * QSBR 방식 RCU에 참여하는 reader 스레드 하나의 기록
+ *
+ * qs는 이 reader가 마지막으로 quiescent 상태(공유 데이터를 가리키는 포인터를 하나도 들고 있지 않은 때)를
+ * 지나면서 본 grace period 번호이며, 0이면 offline이라서 writer가 기다리지 않는다.
+ * 자기 qs만 고치므로 캐시 라인 하나를 따로 쓴다.
+ */
+typedef struct rcu_reader {
+    _Alignas(RCU_CACHELINE) _Atomic uint64_t qs;
+    struct rcu_reader *next;
+    struct rcu *rcu;
+} rcu_reader_t;
+
+/*
+ * 지우기를 미룬 옛 버전 하나의 기록
+ */
+struct rcu_retired {
+    void *ptr;
+    void (*free_fn)(void *ptr);
+    struct rcu_retired *next;
+};
+
+/*
+ * RCU 도메인 구조체 타입
+ *
+ * reader는 잠금이나 원자적 RMW 없이 rcu_dereference()로 읽고, 틈틈이 rcu_quiescent()를 불러 자기 qs에
+ * 현재 gp를 적기만 한다. writer는 rcu_assign_pointer()로 새 버전을 내보낸 뒤 옛 버전을 rcu_retire()에 넘긴다.
+ * 옛 버전이 RCU_BATCH개 모이면 rcu_synchronize()로 gp를 올리고 online인 모든 reader의 qs가 따라올 때까지
+ * 기다린 뒤 한꺼번에 지운다. 그때쯤이면 옛 버전을 읽던 reader는 모두 quiescent 상태를 지났기 때문이다.
+ * mutex는 reader 목록과 지우기를 미룬 목록을 보호하고 grace period를 한 번에 하나씩 진행하게 한다.
+ */
+typedef struct rcu {
+    _Atomic uint64_t gp;            /* 현재 grace period 번호, 1부터 시작 */
+    pthread_mutex_t mutex;          /* readers, pending을 보호하는 상호배타 락 */
+    rcu_reader_t *readers;          /* 등록된 reader 목록 */
+    struct rcu_retired *pending;    /* 지우기를 미룬 옛 버전 목록 */
+    int npending;                   /* pending의 길이 */
+} rcu_t;
+
+int rcu_init(rcu_t *rcu);
+int rcu_destroy(rcu_t *rcu);
+rcu_reader_t *rcu_register(rcu_t *rcu);
+void rcu_unregister(rcu_reader_t *r);
+void rcu_quiescent(rcu_reader_t *r);
+void rcu_offline(rcu_reader_t *r);
+void rcu_online(rcu_reader_t *r);
+void rcu_synchronize(rcu_t *rcu);
+int rcu_retire(rcu_t *rcu, void *ptr, void (*free_fn)(void *ptr));
+void rcu_barrier(rcu_t *rcu);
+
+#endif
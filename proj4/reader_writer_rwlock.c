@@ -0,0 +1,565 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by Kim Taehyeon (2019061658 컴퓨터학부 김태현) (26.10.19)
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include <string.h>
+#include <pthread.h>
+#include "rwlock.h"
+
+#define L0 8192
+#define L1 70
+#define L2 70
+#define L3 65
+#define L4 50
+#define L5 70
+#define NREAD 20
+#define NWRITE 5
+#define RUNTIME 200000000L
+#define SLEEPTIME 100000
+
+char *img1[L1] = {
+    "\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x51\x4F\x4F\x36\x4F\x49\x4F\x51\x36\x4F\x51\x4D\x51\x4F\x49\x49\x4F\x4F\x36\x49\x4F\x49\x49\x49\x4F\x7C\x21\x5E\x49\x5E\x36\x49\x7C\x49\x7C\x36\x49\x36\x49\x4D\x4F\x4D\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51",
+    "\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4F\x4F\x4F\x36\x49\x36\x49\x7C\x49\x49\x7C\x7C\x49\x49\x49\x49\x49\x49\x7C\x21\x7C\x7C\x49\x21\x7C\x49\x5E\x2E\x2E\x21\x5E\x7C\x21\x7C\x5E\x21\x21\x5E\x36\x4F\x49\x51\x36\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x51\x4D\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51",
+    "\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x4F\x49\x36\x49\x49\x7C\x49\x49\x49\x49\x7C\x7C\x49\x7C\x7C\x7C\x49\x7C\x21\x7C\x7C\x7C\x21\x5E\x5E\x5E\x2E\x5E\x21\x5E\x5E\x21\x2E\x5E\x21\x21\x5E\x5E\x2E\x5E\x2E\x5E\x7C\x21\x49\x36\x51\x51\x4D\x4D\x4D\x4D\x36\x51\x51\x51\x4F\x51\x51\x4F\x51\x51\x51\x4F\x51\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D",
+    "\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x4F\x36\x36\x49\x36\x49\x49\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x7C\x21\x7C\x21\x7C\x21\x5E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x20\x20\x2E\x5E\x21\x2E\x2E\x20\x2E\x2E\x7C\x7C\x4F\x36\x51\x4F\x36\x49\x49\x36\x21\x36\x36\x51\x4F\x4D\x51\x4F\x4D\x4D\x51\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51",
+    "\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x4F\x36\x4F\x4F\x36\x49\x7C\x49\x49\x49\x7C\x7C\x7C\x7C\x7C\x21\x21\x7C\x21\x21\x21\x21\x5E\x21\x5E\x2E\x20\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x20\x2E\x2E\x2E\x2E\x20\x20\x2E\x2E\x2E\x21\x7C\x5E\x49\x7C\x21\x21\x21\x7C\x49\x7C\x7C\x36\x36\x36\x51\x49\x36\x36\x7C\x49\x4F\x51\x49\x36\x4F\x49\x36\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D",
+    "\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x4F\x36\x49\x49\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x21\x21\x21\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x20\x5E\x20\x2E\x20\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x20\x5E\x21\x5E\x2E\x5E\x5E\x7C\x21\x7C\x49\x21\x36\x4F\x36\x4D\x4D\x5E\x4F\x36\x49\x4F\x51\x4F\x51\x4D\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51",
+    "\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x51\x4D\x4D\x51\x4F\x49\x49\x7C\x7C\x7C\x49\x7C\x21\x7C\x21\x21\x5E\x5E\x21\x2E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x20\x5E\x2E\x2E\x21\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x5E\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x21\x7C\x49\x36\x51\x4D\x4F\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x51\x4D",
+    "\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4F\x4F\x36\x49\x49\x7C\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x21\x21\x5E\x2E\x2E\x21\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x20\x5E\x2E\x2E\x5E\x21\x5E\x2E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x20\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x2E\x5E\x5E\x21\x49\x36\x51\x4D\x51\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x51",
+    "\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4F\x49\x36\x49\x7C\x7C\x49\x7C\x7C\x7C\x21\x7C\x49\x7C\x7C\x5E\x21\x2E\x2E\x5E\x5E\x2E\x2E\x20\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x20\x5E\x5E\x21\x21\x2E\x21\x20\x5E\x5E\x21\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x2E\x2E\x5E\x5E\x5E\x2E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x5E\x7C\x49\x4F\x51\x36\x36\x4D\x4D\x4F\x4F\x4D\x51\x4D\x4D\x4D\x4D\x51",
+    "\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4F\x4F\x49\x7C\x7C\x21\x7C\x7C\x49\x7C\x7C\x21\x7C\x7C\x21\x7C\x21\x21\x7C\x21\x21\x2E\x5E\x2E\x2E\x2E\x2E\x5E\x2E\x20\x2E\x5E\x2E\x2E\x2E\x7C\x21\x21\x5E\x5E\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x20\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x2E\x5E\x2E\x21\x5E\x5E\x2E\x5E\x21\x21\x36\x4D\x4F\x36\x4D\x4D\x51\x4D\x4D\x4D",
+    "\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x49\x7C\x7C\x7C\x49\x49\x7C\x49\x49\x49\x49\x49\x49\x7C\x49\x7C\x21\x21\x5E\x21\x7C\x7C\x21\x21\x20\x2E\x20\x5E\x5E\x2E\x5E\x5E\x5E\x2E\x2E\x21\x5E\x5E\x7C\x21\x5E\x5E\x2E\x2E\x5E\x7C\x21\x21\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x20\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x20\x2E\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x5E\x5E\x21\x7C\x49\x36\x49\x7C\x36\x36\x4F\x4D\x51\x4D\x4D\x4D",
+    "\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x51\x4F\x49\x7C\x7C\x7C\x7C\x49\x49\x7C\x7C\x7C\x49\x7C\x49\x7C\x7C\x7C\x7C\x21\x21\x21\x21\x21\x5E\x7C\x21\x20\x21\x20\x21\x2E\x5E\x5E\x7C\x7C\x21\x7C\x5E\x21\x21\x7C\x2E\x5E\x5E\x5E\x2E\x21\x7C\x21\x5E\x5E\x5E\x5E\x5E\x20\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x2E\x20\x2E\x5E\x2E\x5E\x21\x5E\x5E\x21\x7C\x49\x51\x36\x49\x36\x4D\x4D\x4F\x4D\x4D\x51",
+    "\x4D\x51\x4D\x4D\x4D\x4D\x4D\x36\x7C\x21\x21\x7C\x7C\x7C\x49\x7C\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x7C\x7C\x21\x49\x7C\x7C\x5E\x21\x2E\x5E\x2E\x2E\x20\x2E\x21\x5E\x5E\x5E\x21\x21\x2E\x21\x5E\x7C\x7C\x7C\x21\x21\x21\x49\x7C\x21\x7C\x21\x21\x7C\x5E\x5E\x2E\x5E\x2E\x5E\x21\x21\x5E\x5E\x5E\x5E\x2E\x2E\x20\x20\x2E\x20\x2E\x20\x20\x20\x2E\x20\x20\x20\x2E\x2E\x2E\x2E\x2E\x5E\x21\x21\x5E\x21\x21\x7C\x21\x36\x4F\x49\x51\x51\x4D\x51\x4D\x51",
+    "\x4D\x51\x4D\x4D\x36\x7C\x49\x4F\x7C\x49\x7C\x49\x7C\x49\x49\x49\x7C\x49\x7C\x49\x7C\x7C\x7C\x7C\x21\x21\x7C\x7C\x21\x7C\x7C\x7C\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x21\x5E\x5E\x5E\x5E\x21\x7C\x49\x7C\x7C\x7C\x7C\x21\x21\x7C\x7C\x7C\x21\x21\x5E\x5E\x21\x7C\x21\x5E\x2E\x21\x2E\x5E\x5E\x20\x5E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x2E\x2E\x5E\x2E\x21\x21\x7C\x49\x4F\x36\x51\x51\x51\x4D\x4D",
+    "\x51\x4D\x4D\x4F\x49\x49\x51\x36\x36\x49\x49\x49\x7C\x7C\x49\x49\x49\x49\x49\x49\x49\x49\x49\x7C\x49\x7C\x7C\x49\x49\x7C\x7C\x7C\x21\x21\x7C\x21\x21\x7C\x21\x21\x2E\x5E\x21\x21\x21\x20\x5E\x21\x5E\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x5E\x5E\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x20\x20\x2E\x20\x20\x20\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x5E\x21\x7C\x21\x36\x49\x4D\x51\x4D\x51\x4D",
+    "\x51\x4D\x4D\x4D\x51\x4F\x36\x49\x36\x7C\x7C\x7C\x49\x7C\x49\x7C\x7C\x49\x7C\x49\x49\x7C\x7C\x49\x49\x36\x36\x36\x49\x49\x49\x7C\x21\x21\x7C\x7C\x7C\x21\x21\x5E\x7C\x5E\x7C\x21\x2E\x5E\x21\x21\x7C\x21\x7C\x7C\x7C\x21\x21\x7C\x21\x21\x21\x5E\x21\x5E\x5E\x21\x21\x21\x5E\x7C\x21\x5E\x5E\x21\x5E\x21\x21\x5E\x21\x2E\x21\x5E\x5E\x21\x5E\x2E\x2E\x20\x2E\x20\x20\x20\x2E\x20\x20\x2E\x5E\x2E\x2E\x5E\x5E\x20\x5E\x2E\x2E\x5E\x49\x4F\x51\x4D\x51\x4D",
+    "\x4D\x51\x4D\x4F\x36\x49\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x49\x49\x49\x36\x49\x49\x36\x49\x36\x49\x36\x49\x49\x49\x49\x7C\x49\x49\x49\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x2E\x21\x5E\x5E\x5E\x21\x21\x21\x5E\x21\x21\x21\x21\x5E\x21\x21\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x21\x21\x21\x7C\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x7C\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x5E\x49\x21\x49\x49\x49\x51\x4D",
+    "\x4D\x4D\x51\x21\x5E\x21\x21\x7C\x21\x7C\x21\x7C\x7C\x7C\x7C\x49\x36\x49\x36\x49\x36\x4F\x4F\x36\x4F\x36\x49\x36\x36\x49\x49\x49\x49\x49\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x5E\x21\x5E\x21\x21\x21\x21\x5E\x21\x21\x5E\x2E\x5E\x5E\x2E\x2E\x5E\x2E\x20\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x21\x2E\x2E\x20\x2E\x2E\x20\x20\x20\x20\x2E\x2E\x2E\x5E\x2E\x2E\x20\x5E\x5E\x7C\x7C\x49\x36\x51\x4D\x4D",
+    "\x36\x7C\x21\x21\x7C\x21\x7C\x21\x7C\x21\x21\x21\x7C\x7C\x49\x49\x49\x49\x36\x36\x36\x4F\x4F\x4F\x4F\x36\x36\x36\x49\x21\x49\x7C\x7C\x49\x49\x7C\x49\x7C\x7C\x21\x7C\x21\x5E\x21\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x2E\x2E\x20\x20\x20\x2E\x20\x20\x2E\x20\x20\x20\x2E\x20\x20\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x20\x20\x20\x2E\x5E\x49\x4F\x7C\x36\x49\x51",
+    "\x4F\x7C\x21\x21\x7C\x7C\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x36\x49\x36\x36\x4F\x4F\x36\x49\x21\x49\x21\x49\x36\x49\x49\x7C\x49\x49\x7C\x7C\x21\x21\x21\x7C\x21\x5E\x2E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x20\x2E\x20\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x20\x20\x5E\x21\x2E\x2E\x20\x20\x2E\x20\x20\x2E\x2E\x2E\x2E\x20\x20\x2E\x49\x4D\x51\x36\x51",
+    "\x4F\x49\x7C\x7C\x49\x49\x7C\x7C\x21\x7C\x7C\x7C\x49\x49\x49\x7C\x49\x49\x49\x49\x49\x36\x36\x36\x49\x49\x36\x4F\x4F\x36\x49\x7C\x49\x7C\x49\x7C\x21\x21\x21\x21\x5E\x21\x21\x21\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x20\x20\x2E\x20\x20\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x20\x2E\x2E\x5E\x21\x5E\x2E\x20\x2E\x2E\x2E\x2E\x20\x2E\x20\x20\x20\x2E\x5E\x21\x21\x36\x4D",
+    "\x4F\x7C\x5E\x21\x5E\x7C\x7C\x49\x7C\x49\x49\x49\x7C\x7C\x49\x49\x49\x7C\x7C\x49\x49\x36\x49\x36\x4F\x4F\x4F\x36\x36\x36\x7C\x7C\x49\x49\x49\x7C\x49\x7C\x49\x7C\x21\x5E\x21\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x20\x2E\x5E\x2E\x20\x20\x20\x20\x2E\x20\x20\x20\x2E\x2E\x20\x2E\x2E\x2E\x2E\x21\x21\x21\x5E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x20\x2E\x20\x2E\x2E\x21",
+    "\x36\x7C\x5E\x5E\x21\x21\x7C\x49\x7C\x7C\x7C\x49\x49\x7C\x21\x7C\x7C\x49\x49\x36\x49\x36\x4F\x4F\x51\x49\x49\x36\x36\x36\x4F\x51\x49\x7C\x49\x7C\x7C\x21\x21\x21\x5E\x5E\x5E\x5E\x21\x5E\x21\x21\x7C\x21\x21\x21\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x20\x20\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x5E\x20\x2E\x5E\x21\x5E\x5E\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x5E\x2E\x5E\x21",
+    "\x21\x5E\x5E\x5E\x5E\x5E\x21\x21\x7C\x7C\x7C\x49\x7C\x49\x49\x36\x4F\x36\x49\x7C\x36\x4F\x51\x51\x36\x4F\x4F\x4F\x4F\x49\x36\x49\x36\x36\x36\x36\x49\x7C\x7C\x21\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x20\x20\x2E\x20\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x5E\x2E\x2E\x20\x20\x20\x21\x2E\x20\x5E\x5E\x2E\x2E\x20\x2E\x20\x20\x5E\x2E\x2E\x5E\x21\x21\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x2E\x2E\x5E\x21\x5E\x2E\x2E\x5E",
+    "\x5E\x5E\x21\x21\x7C\x7C\x7C\x7C\x21\x21\x7C\x49\x49\x49\x36\x49\x49\x49\x7C\x49\x49\x36\x36\x36\x51\x4F\x7C\x49\x36\x36\x49\x49\x36\x36\x49\x7C\x49\x7C\x7C\x21\x21\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x21\x2E\x5E\x2E\x2E\x5E\x5E\x7C\x21\x21\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x21\x5E\x2E\x2E\x2E\x21\x49",
+    "\x21\x5E\x7C\x7C\x7C\x7C\x21\x7C\x49\x7C\x7C\x49\x7C\x49\x49\x36\x36\x49\x49\x36\x36\x51\x51\x51\x4F\x36\x36\x36\x49\x36\x4F\x51\x4F\x49\x49\x49\x7C\x7C\x21\x5E\x21\x5E\x5E\x2E\x2E\x2E\x5E\x5E\x21\x5E\x5E\x5E\x7C\x7C\x7C\x7C\x7C\x21\x21\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x21\x2E\x5E\x5E\x21\x21\x21\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x21\x21\x49",
+    "\x5E\x5E\x21\x21\x7C\x7C\x7C\x7C\x21\x7C\x49\x49\x49\x49\x7C\x36\x36\x36\x4F\x36\x36\x51\x51\x4F\x4F\x4F\x4F\x51\x4F\x49\x49\x49\x49\x49\x49\x49\x49\x49\x7C\x49\x7C\x7C\x21\x5E\x5E\x5E\x5E\x5E\x21\x7C\x21\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x5E\x21\x5E\x2E\x20\x20\x20\x20\x20\x2E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x7C\x21\x5E\x21\x2E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x5E\x5E\x49",
+    "\x5E\x7C\x21\x21\x7C\x21\x7C\x49\x49\x7C\x49\x7C\x49\x49\x49\x49\x36\x36\x36\x36\x4F\x36\x4F\x51\x4F\x36\x36\x49\x36\x49\x49\x49\x7C\x49\x49\x36\x49\x7C\x7C\x7C\x21\x5E\x21\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x21\x21\x21\x5E\x5E\x21\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x21\x5E\x2E\x5E\x2E\x2E\x2E\x21\x2E\x2E\x2E\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x5E\x2E\x5E\x5E\x5E\x21\x21\x7C\x21\x21\x21\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20",
+    "\x7C\x7C\x49\x5E\x5E\x21\x5E\x21\x7C\x49\x49\x49\x49\x49\x36\x4F\x49\x36\x4F\x36\x4F\x4F\x51\x4F\x51\x4F\x36\x36\x36\x36\x36\x36\x4F\x36\x49\x49\x7C\x7C\x49\x7C\x7C\x49\x49\x49\x7C\x49\x21\x7C\x7C\x21\x5E\x7C\x7C\x7C\x21\x7C\x21\x21\x5E\x5E\x21\x7C\x21\x21\x21\x7C\x7C\x21\x21\x7C\x7C\x49\x21\x21\x7C\x7C\x5E\x21\x2E\x2E\x20\x2E\x20\x2E\x2E\x20\x5E\x2E\x5E\x5E\x7C\x21\x21\x21\x5E\x21\x5E\x5E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x2E\x2E",
+    "\x49\x36\x36\x49\x21\x7C\x21\x7C\x7C\x7C\x49\x36\x49\x36\x49\x49\x4F\x4F\x4F\x4F\x51\x4F\x4F\x4F\x4F\x4F\x4F\x36\x36\x36\x36\x7C\x7C\x49\x7C\x7C\x7C\x21\x7C\x21\x21\x5E\x21\x5E\x5E\x2E\x2E\x20\x20\x20\x2E\x2E\x5E\x21\x7C\x7C\x49\x7C\x21\x7C\x21\x21\x21\x21\x21\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x5E\x2E\x5E\x2E\x20\x21\x5E\x21\x7C\x5E\x21\x2E\x5E\x2E\x2E\x20\x2E\x2E\x20\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x5E",
+    "\x51\x4F\x36\x36\x36\x4F\x36\x49\x49\x49\x49\x49\x49\x36\x36\x36\x36\x49\x4F\x36\x4F\x51\x4F\x51\x51\x4F\x36\x36\x49\x49\x7C\x49\x36\x36\x4F\x36\x4F\x36\x4F\x4F\x36\x36\x7C\x49\x21\x7C\x21\x2E\x2E\x2E\x2E\x2E\x20\x20\x5E\x2E\x5E\x5E\x21\x5E\x21\x5E\x7C\x21\x5E\x5E\x5E\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x2E\x20\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x2E\x2E\x21\x5E\x21\x5E\x2E\x21\x20\x2E\x20\x2E\x2E\x2E\x2E\x20\x5E\x2E\x5E\x2E\x2E\x2E\x5E\x21",
+    "\x4D\x4F\x36\x49\x36\x36\x49\x49\x7C\x7C\x7C\x21\x7C\x49\x49\x36\x36\x36\x4F\x4F\x51\x4D\x4F\x51\x51\x4F\x36\x49\x49\x7C\x49\x4F\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x36\x36\x49\x7C\x21\x5E\x2E\x2E\x2E\x20\x20\x5E\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x5E\x21\x5E\x5E\x21\x5E\x21\x7C\x21\x21\x21\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x2E\x5E\x21\x21\x21\x21\x7C\x5E\x20\x2E\x20\x5E\x5E\x2E\x5E\x2E\x5E\x21\x2E\x5E\x20\x2E\x5E\x5E\x5E",
+    "\x4D\x36\x4F\x49\x49\x36\x36\x4F\x4F\x36\x49\x7C\x7C\x49\x49\x36\x36\x51\x51\x51\x4F\x4F\x4F\x4F\x51\x4F\x49\x49\x7C\x36\x36\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x36\x36\x4F\x36\x49\x21\x21\x21\x5E\x20\x2E\x2E\x5E\x5E\x5E\x5E\x2E\x5E\x21\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x49\x49\x7C\x7C\x21\x21\x5E\x5E\x21\x20\x20\x20\x20\x2E\x2E\x2E\x21\x21\x7C\x5E\x7C\x5E\x21\x20\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x2E\x2E\x21\x7C\x21\x21\x5E",
+    "\x4F\x36\x36\x49\x7C\x49\x49\x36\x51\x51\x4F\x49\x49\x7C\x36\x4F\x4F\x51\x51\x51\x4F\x4F\x36\x4F\x4F\x4F\x36\x36\x36\x36\x36\x4F\x36\x4F\x51\x4F\x4D\x51\x4D\x51\x51\x51\x4D\x51\x4D\x51\x51\x4F\x36\x36\x49\x49\x21\x21\x7C\x21\x21\x21\x21\x21\x7C\x21\x21\x49\x36\x49\x36\x51\x4F\x4D\x4D\x4D\x4D\x4D\x51\x4F\x4F\x49\x49\x49\x36\x21\x20\x20\x20\x2E\x2E\x5E\x21\x21\x21\x7C\x49\x21\x2E\x2E\x21\x5E\x5E\x2E\x5E\x5E\x7C\x5E\x5E\x21\x21\x21\x21\x7C",
+    "\x4F\x4F\x36\x21\x49\x49\x49\x49\x4D\x4D\x4D\x51\x4F\x36\x4F\x36\x4F\x51\x4F\x4F\x4F\x36\x36\x36\x4F\x36\x4F\x4F\x51\x4D\x4F\x4F\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4F\x36\x4F\x36\x7C\x7C\x7C\x49\x21\x21\x7C\x49\x36\x36\x4F\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x36\x49\x7C\x7C\x5E\x2E\x5E\x2E\x5E\x5E\x7C\x7C\x21\x21\x5E\x2E\x21\x21\x21\x7C\x7C\x21\x7C\x21\x21\x5E\x7C\x49\x7C\x7C",
+    "\x51\x4F\x5E\x7C\x49\x7C\x49\x49\x49\x4F\x36\x36\x4D\x4F\x4F\x36\x51\x4F\x51\x4F\x4F\x36\x36\x36\x36\x36\x4F\x4D\x4D\x51\x4F\x4F\x4D\x4D\x4F\x4F\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4F\x49\x49\x49\x7C\x7C\x7C\x7C\x49\x7C\x4F\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x36\x7C\x21\x2E\x5E\x5E\x5E\x21\x7C\x21\x5E\x20\x21\x7C\x5E\x49\x49\x5E\x21\x21\x21\x7C\x7C\x21\x49\x7C\x49",
+    "\x36\x21\x49\x21\x49\x7C\x49\x7C\x7C\x7C\x51\x4D\x4D\x4D\x4D\x51\x4D\x4F\x4F\x51\x36\x36\x36\x36\x36\x4F\x4F\x4F\x4F\x4F\x51\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x51\x36\x49\x7C\x7C\x21\x21\x7C\x36\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x4D\x51\x4D\x7C\x7C\x49\x4D\x4D\x7C\x49\x36\x7C\x21\x2E\x5E\x21\x5E\x21\x21\x5E\x20\x2E\x5E\x2E\x7C\x7C\x21\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C",
+    "\x49\x36\x7C\x7C\x49\x21\x7C\x21\x21\x7C\x36\x4D\x4D\x4D\x4D\x4D\x4F\x51\x4F\x4F\x4F\x36\x36\x36\x49\x36\x4F\x36\x4F\x4D\x4D\x4D\x4D\x4F\x4D\x51\x36\x4D\x4D\x51\x4D\x4D\x51\x4F\x51\x51\x21\x51\x51\x4F\x51\x36\x36\x49\x7C\x21\x5E\x5E\x2E\x5E\x49\x4F\x4D\x4D\x51\x4D\x4D\x4D\x36\x7C\x4D\x51\x4D\x51\x4D\x4D\x4F\x4D\x4D\x4D\x4D\x4D\x36\x5E\x7C\x49\x21\x5E\x5E\x21\x5E\x5E\x7C\x2E\x2E\x21\x2E\x7C\x21\x21\x7C\x21\x21\x21\x21\x7C\x7C\x49\x36\x49",
+    "\x7C\x36\x49\x7C\x21\x21\x21\x7C\x7C\x7C\x49\x36\x49\x36\x4F\x49\x7C\x36\x4F\x4F\x49\x36\x36\x36\x49\x36\x36\x51\x36\x51\x4D\x36\x4F\x51\x51\x49\x36\x49\x49\x7C\x49\x36\x49\x49\x36\x49\x7C\x36\x36\x4F\x36\x49\x36\x49\x7C\x21\x5E\x20\x2E\x5E\x5E\x21\x49\x36\x49\x21\x4F\x51\x36\x49\x36\x4D\x4D\x51\x4D\x7C\x7C\x7C\x5E\x21\x4D\x51\x4D\x4F\x21\x49\x5E\x2E\x2E\x2E\x5E\x21\x7C\x5E\x5E\x21\x7C\x49\x5E\x2E\x21\x21\x7C\x7C\x7C\x49\x49\x49\x36\x49",
+    "\x49\x49\x7C\x7C\x21\x7C\x7C\x49\x7C\x5E\x21\x4F\x4F\x49\x36\x7C\x7C\x49\x4F\x36\x36\x36\x4F\x49\x36\x4F\x36\x36\x4F\x4F\x4F\x4F\x49\x36\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x51\x51\x36\x49\x49\x7C\x36\x7C\x21\x5E\x2E\x20\x20\x20\x2E\x2E\x5E\x21\x49\x7C\x49\x51\x4F\x4F\x36\x49\x7C\x21\x7C\x21\x21\x49\x7C\x21\x7C\x4D\x36\x7C\x21\x5E\x2E\x2E\x20\x2E\x5E\x7C\x7C\x36\x4F\x49\x49\x7C\x21\x5E\x7C\x21\x21\x7C\x7C\x21\x7C\x7C\x36\x49",
+    "\x49\x49\x7C\x49\x21\x7C\x49\x7C\x7C\x21\x7C\x7C\x36\x4F\x21\x21\x49\x7C\x49\x36\x36\x36\x49\x36\x36\x49\x36\x36\x49\x36\x49\x36\x49\x36\x36\x36\x4F\x4F\x4F\x36\x4F\x4F\x51\x51\x51\x51\x36\x49\x49\x49\x49\x49\x49\x49\x21\x2E\x2E\x20\x20\x2E\x5E\x2E\x5E\x5E\x2E\x49\x49\x36\x4F\x36\x4F\x4F\x4F\x4F\x4F\x36\x49\x49\x7C\x21\x5E\x21\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x49\x51\x4F\x49\x36\x7C\x7C\x7C\x7C\x21\x21\x21\x21\x21\x21\x7C\x7C\x7C",
+    "\x49\x49\x49\x49\x7C\x21\x7C\x7C\x21\x7C\x21\x49\x49\x36\x7C\x7C\x7C\x49\x49\x36\x36\x49\x4F\x36\x36\x36\x36\x49\x49\x49\x36\x36\x36\x49\x36\x49\x49\x4F\x4F\x4F\x4F\x51\x4F\x4F\x36\x36\x49\x49\x49\x7C\x49\x49\x49\x49\x7C\x5E\x2E\x20\x20\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x21\x49\x36\x36\x36\x49\x7C\x7C\x21\x5E\x5E\x5E\x21\x5E\x21\x7C\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x2E\x21\x4F\x49\x49\x7C\x49\x7C\x7C\x21\x21\x5E\x21\x5E\x21\x21\x21\x7C\x49",
+    "\x36\x49\x49\x36\x7C\x7C\x7C\x7C\x5E\x49\x7C\x49\x7C\x7C\x21\x7C\x49\x49\x21\x49\x36\x36\x49\x36\x36\x4F\x36\x49\x49\x36\x49\x49\x49\x36\x49\x36\x49\x49\x36\x49\x36\x36\x4F\x36\x49\x49\x36\x49\x7C\x49\x49\x49\x49\x49\x49\x5E\x2E\x20\x20\x20\x20\x2E\x2E\x5E\x5E\x2E\x2E\x21\x7C\x7C\x36\x4F\x4F\x36\x49\x7C\x21\x5E\x5E\x2E\x20\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x5E\x5E\x5E\x2E\x5E\x49\x49\x7C\x49\x7C\x21\x21\x21\x7C\x5E\x5E\x2E\x5E\x5E\x5E\x49\x49",
+    "\x36\x36\x7C\x36\x49\x49\x7C\x7C\x21\x7C\x7C\x49\x7C\x36\x49\x49\x36\x36\x7C\x7C\x36\x36\x49\x49\x49\x36\x36\x49\x36\x49\x36\x49\x36\x36\x4F\x4F\x4F\x4F\x36\x36\x36\x36\x49\x36\x49\x49\x36\x49\x36\x49\x36\x36\x49\x49\x49\x21\x5E\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x7C\x21\x7C\x49\x7C\x7C\x7C\x5E\x2E\x21\x5E\x5E\x5E\x2E\x2E\x2E\x5E\x2E\x20\x2E\x21\x20\x5E\x49\x7C\x49\x49\x7C\x5E\x7C\x21\x21\x5E\x5E\x2E\x5E\x2E\x5E\x21\x21",
+    "\x4F\x4F\x36\x49\x7C\x49\x49\x7C\x7C\x5E\x7C\x36\x36\x49\x4F\x49\x36\x49\x21\x49\x36\x36\x49\x36\x4F\x4F\x4F\x36\x36\x36\x49\x36\x49\x36\x49\x49\x36\x36\x36\x36\x49\x49\x49\x7C\x49\x49\x49\x49\x36\x49\x36\x49\x36\x49\x7C\x21\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x36\x49\x7C\x7C\x21\x21\x5E\x7C\x5E\x5E\x2E\x2E\x5E\x2E\x20\x5E\x21\x2E\x5E\x49\x49\x5E\x7C\x7C\x21\x5E\x21\x21\x21\x5E\x2E\x2E\x2E\x2E\x5E\x5E",
+    "\x36\x36\x49\x7C\x36\x49\x7C\x49\x7C\x21\x7C\x49\x36\x49\x51\x4F\x49\x7C\x21\x7C\x49\x49\x49\x49\x4F\x36\x36\x36\x36\x36\x4F\x36\x36\x49\x36\x4F\x36\x36\x49\x49\x49\x7C\x7C\x7C\x7C\x49\x49\x49\x49\x36\x36\x49\x7C\x49\x21\x5E\x2E\x2E\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x2E\x2E\x2E\x5E\x21\x5E\x7C\x21\x49\x7C\x49\x7C\x49\x7C\x21\x5E\x2E\x20\x20\x2E\x2E\x2E\x20\x36\x7C\x21\x5E\x21\x7C\x5E\x21\x2E\x5E\x7C\x21\x5E\x2E\x5E\x2E\x2E\x21",
+    "\x7C\x21\x21\x5E\x5E\x7C\x7C\x7C\x49\x5E\x21\x49\x4F\x36\x51\x4F\x51\x51\x36\x7C\x7C\x49\x49\x49\x36\x36\x36\x36\x4F\x36\x4F\x36\x36\x49\x36\x49\x49\x49\x49\x49\x7C\x7C\x7C\x7C\x49\x49\x36\x4D\x51\x51\x36\x36\x7C\x7C\x5E\x5E\x2E\x20\x20\x20\x20\x20\x20\x2E\x49\x36\x21\x20\x20\x20\x20\x20\x2E\x2E\x21\x21\x5E\x7C\x7C\x36\x49\x21\x7C\x21\x2E\x2E\x20\x20\x5E\x2E\x2E\x21\x5E\x49\x7C\x7C\x2E\x5E\x49\x7C\x49\x21\x7C\x21\x21\x2E\x20\x2E\x5E\x2E",
+    "\x21\x5E\x21\x36\x49\x4F\x21\x49\x7C\x7C\x36\x36\x51\x49\x4F\x4F\x36\x36\x51\x7C\x21\x7C\x49\x49\x49\x36\x36\x49\x36\x36\x49\x49\x49\x7C\x49\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x49\x36\x51\x4F\x36\x36\x36\x49\x49\x49\x7C\x2E\x5E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x7C\x36\x7C\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x7C\x7C\x21\x21\x5E\x2E\x2E\x20\x49\x36\x49\x2E\x5E\x49\x21\x5E\x21\x7C\x5E\x2E\x21\x21\x7C\x7C\x49\x7C\x2E\x2E\x20\x21\x5E",
+    "\x49\x49\x49\x36\x49\x36\x49\x36\x36\x49\x49\x4F\x4F\x36\x4F\x4F\x36\x36\x51\x7C\x21\x49\x49\x49\x36\x49\x49\x36\x49\x7C\x7C\x49\x49\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x49\x49\x4F\x51\x51\x36\x49\x49\x36\x36\x49\x7C\x21\x5E\x2E\x5E\x5E\x5E\x20\x20\x20\x20\x20\x20\x20\x49\x36\x49\x7C\x5E\x2E\x20\x20\x20\x20\x20\x20\x2E\x2E\x5E\x21\x21\x5E\x20\x2E\x20\x49\x2E\x7C\x7C\x5E\x36\x7C\x21\x5E\x7C\x21\x7C\x21\x49\x5E\x7C\x21\x7C\x21\x2E\x5E\x5E\x21",
+    "\x51\x4F\x4F\x36\x36\x7C\x36\x36\x4F\x49\x7C\x36\x49\x36\x49\x36\x36\x4F\x4F\x4D\x21\x7C\x7C\x7C\x49\x36\x49\x49\x49\x49\x49\x49\x49\x49\x7C\x7C\x7C\x7C\x49\x7C\x49\x51\x51\x4F\x49\x49\x36\x49\x49\x36\x36\x49\x49\x7C\x7C\x21\x21\x5E\x5E\x2E\x20\x20\x20\x20\x2E\x20\x2E\x7C\x4F\x36\x7C\x21\x5E\x20\x20\x20\x20\x20\x20\x2E\x5E\x5E\x5E\x2E\x5E\x20\x7C\x36\x7C\x49\x7C\x5E\x7C\x21\x7C\x5E\x21\x21\x21\x49\x21\x7C\x4F\x5E\x21\x21\x5E\x5E\x2E\x49",
+    "\x4D\x51\x4F\x4F\x36\x49\x4F\x4F\x36\x4F\x36\x4D\x4D\x51\x51\x4F\x4F\x36\x51\x4D\x51\x7C\x49\x7C\x49\x49\x49\x49\x49\x36\x49\x49\x49\x49\x7C\x7C\x49\x7C\x49\x36\x51\x36\x7C\x49\x49\x36\x49\x51\x51\x4F\x51\x4F\x36\x49\x49\x49\x7C\x7C\x21\x21\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x21\x5E\x36\x4F\x49\x21\x5E\x20\x2E\x20\x20\x20\x20\x2E\x2E\x5E\x2E\x2E\x5E\x36\x36\x7C\x7C\x7C\x7C\x21\x49\x21\x5E\x21\x5E\x5E\x49\x7C\x21\x7C\x7C\x7C\x21\x2E\x21\x20\x7C",
+    "\x4D\x4D\x51\x36\x36\x4F\x51\x51\x51\x4F\x51\x51\x4D\x51\x4F\x51\x4D\x51\x4D\x4D\x51\x49\x7C\x49\x49\x49\x49\x36\x49\x49\x49\x7C\x7C\x7C\x49\x7C\x49\x49\x36\x4F\x7C\x49\x36\x49\x7C\x49\x7C\x49\x4D\x51\x4D\x4D\x4D\x51\x51\x4F\x36\x36\x49\x49\x49\x7C\x51\x49\x5E\x21\x5E\x5E\x5E\x2E\x7C\x4F\x49\x21\x5E\x5E\x2E\x20\x20\x20\x2E\x2E\x2E\x2E\x20\x7C\x7C\x7C\x21\x5E\x2E\x20\x20\x21\x21\x5E\x21\x5E\x7C\x21\x7C\x21\x21\x5E\x21\x21\x5E\x5E\x49\x5E",
+    "\x4D\x4D\x4D\x51\x4F\x4F\x51\x4F\x4F\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x4D\x51\x7C\x49\x49\x49\x36\x49\x36\x49\x49\x49\x49\x49\x36\x49\x36\x4F\x36\x7C\x49\x49\x49\x7C\x49\x49\x49\x49\x36\x36\x36\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x49\x7C\x2E\x5E\x2E\x21\x5E\x2E\x21\x21\x21\x20\x5E\x36\x49\x49\x5E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x20\x5E\x7C\x21\x20\x20\x20\x20\x20\x2E\x2E\x20\x21\x21\x5E\x5E\x7C\x7C\x21\x7C\x7C\x7C\x21\x2E\x2E\x7C\x7C",
+    "\x4D\x4D\x4D\x51\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4F\x36\x36\x51\x51\x36\x49\x49\x36\x36\x36\x36\x49\x49\x49\x49\x36\x36\x7C\x49\x49\x7C\x49\x49\x49\x7C\x49\x36\x49\x49\x36\x4F\x36\x4F\x4F\x36\x4F\x4F\x36\x36\x49\x7C\x21\x7C\x21\x5E\x2E\x5E\x21\x2E\x2E\x2E\x2E\x20\x20\x20\x5E\x49\x7C\x5E\x2E\x2E\x5E\x5E\x2E\x2E\x21\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x5E\x7C\x7C\x21\x21\x7C\x7C\x49\x49\x7C\x21\x7C\x2E\x21",
+    "\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x36\x36\x36\x4F\x51\x4D\x4D\x4D\x49\x36\x4F\x36\x4F\x36\x49\x36\x49\x36\x4F\x36\x7C\x4F\x49\x49\x51\x49\x36\x51\x4F\x36\x36\x4F\x36\x36\x36\x7C\x49\x49\x7C\x7C\x36\x7C\x4F\x21\x2E\x21\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x20\x20\x20\x2E\x20\x20\x36\x36\x21\x2E\x5E\x5E\x5E\x20\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x21\x21\x49\x49\x49\x21\x49\x7C\x7C\x36\x36\x7C\x49\x5E",
+    "\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4F\x51\x4F\x51\x4F\x4F\x51\x4D\x4D\x4D\x4D\x4F\x36\x4F\x36\x51\x51\x4F\x4F\x4F\x4F\x4F\x49\x4F\x36\x51\x4F\x4F\x36\x36\x4F\x36\x51\x51\x36\x36\x49\x36\x49\x7C\x36\x49\x21\x49\x36\x7C\x49\x21\x7C\x21\x21\x36\x5E\x5E\x7C\x2E\x2E\x2E\x20\x5E\x20\x2E\x20\x36\x36\x7C\x5E\x5E\x21\x5E\x20\x49\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x4F\x36\x7C\x49\x36\x7C\x21\x21\x21\x7C\x7C\x7C\x7C\x49",
+    "\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x4F\x4F\x4F\x51\x51\x51\x36\x4F\x4F\x4D\x4D\x51\x51\x4D\x7C\x7C\x4F\x51\x51\x51\x51\x4D\x4F\x4F\x51\x51\x36\x49\x4D\x51\x4D\x4D\x4F\x4F\x51\x51\x4D\x4D\x49\x36\x49\x36\x4F\x7C\x4F\x36\x36\x4F\x7C\x36\x21\x36\x49\x49\x36\x49\x21\x21\x36\x5E\x2E\x5E\x2E\x2E\x7C\x20\x7C\x21\x7C\x5E\x21\x5E\x5E\x21\x7C\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x51\x4D\x51\x4F\x36\x49\x49\x7C\x7C\x49\x36\x36\x49\x49",
+    "\x4D\x4D\x4D\x4D\x51\x51\x51\x51\x4F\x51\x4F\x51\x51\x51\x36\x4F\x36\x36\x4D\x51\x51\x4D\x4D\x7C\x5E\x21\x51\x51\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x51\x36\x4D\x36\x4F\x4D\x4F\x36\x51\x4F\x49\x51\x4D\x36\x51\x7C\x36\x51\x49\x7C\x4F\x5E\x21\x36\x51\x4D\x4F\x36\x21\x49\x49\x7C\x5E\x49\x21\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x51\x4D\x4D\x4D\x4D\x4F\x49\x7C\x49\x36\x36\x51\x4F\x36",
+    "\x4D\x51\x4F\x51\x51\x51\x51\x4F\x51\x51\x51\x51\x4D\x4F\x4F\x4F\x36\x4F\x51\x51\x51\x4D\x4D\x7C\x2E\x2E\x21\x21\x51\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x51\x4D\x51\x51\x51\x51\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x36\x51\x4F\x4F\x36\x36\x7C\x49\x36\x4D\x4D\x4D\x4F\x7C\x49\x36\x7C\x5E\x49\x36\x7C\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7C\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x4D",
+    "\x51\x51\x51\x51\x4D\x51\x51\x51\x51\x4D\x4D\x4D\x4D\x4F\x51\x4F\x4F\x51\x51\x4D\x4D\x5E\x21\x21\x5E\x2E\x2E\x2E\x21\x21\x4D\x4D\x4D\x4D\x4D\x51\x51\x4F\x4F\x51\x4F\x51\x4F\x4F\x4F\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x51\x36\x49\x36\x49\x49\x21\x21\x7C\x4D\x51\x4F\x4F\x51\x36\x7C\x7C\x49\x21\x7C\x21\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x4F\x4D\x4D\x51\x36\x36\x36\x51\x51\x4F\x51\x4D\x51\x51\x49",
+    "\x4D\x51\x51\x4D\x51\x4D\x4D\x51\x51\x4D\x51\x4D\x4D\x4F\x4F\x4F\x36\x4F\x51\x4D\x4D\x36\x20\x20\x20\x2E\x2E\x2E\x2E\x20\x5E\x49\x4D\x4D\x4D\x4D\x51\x51\x4F\x4F\x4F\x4F\x4F\x4F\x36\x4F\x51\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4F\x36\x36\x36\x49\x7C\x7C\x7C\x7C\x36\x36\x4F\x4D\x4F\x5E\x21\x4F\x36\x36\x5E\x21\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7C\x51\x51\x36\x49\x49\x49\x36\x4F\x4F\x4F\x51\x4F\x4F\x4F\x36",
+    "\x4D\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x51\x51\x51\x36\x4F\x51\x4D\x4D\x4D\x51\x4D\x4D\x51\x2E\x20\x20\x20\x2E\x5E\x2E\x2E\x5E\x49\x51\x4D\x4D\x4D\x4D\x51\x4F\x4F\x4F\x4F\x36\x36\x49\x36\x36\x49\x49\x49\x7C\x36\x49\x49\x49\x49\x7C\x7C\x21\x7C\x49\x7C\x21\x49\x21\x7C\x7C\x7C\x21\x21\x7C\x51\x4D\x51\x36\x7C\x20\x4F\x51\x4F\x51\x49\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x51\x4D\x4F\x36\x4F\x36\x36\x4F\x49\x4F\x36\x36\x4F\x36\x4F\x51\x51",
+    "\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x7C\x20\x20\x20\x2E\x21\x5E\x2E\x21\x7C\x51\x4D\x4D\x4D\x4D\x4D\x51\x51\x4F\x4F\x36\x36\x36\x49\x36\x49\x7C\x49\x21\x7C\x7C\x7C\x7C\x7C\x7C\x21\x5E\x2E\x2E\x2E\x2E\x5E\x21\x5E\x21\x7C\x4D\x4D\x51\x36\x4D\x21\x20\x49\x4D\x4D\x51\x51\x36\x36\x2E\x20\x20\x20\x20\x20\x20\x20\x49\x51\x4D\x51\x4F\x4F\x4F\x36\x36\x4F\x4F\x4F\x51\x36\x4F\x36\x4D\x4D",
+    "\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x7C\x21\x5E\x21\x36\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x51\x4F\x4F\x4F\x36\x36\x4F\x36\x36\x49\x36\x49\x36\x36\x36\x36\x49\x7C\x7C\x7C\x21\x21\x21\x7C\x7C\x51\x4D\x4D\x4F\x4D\x4D\x49\x20\x20\x51\x4D\x4D\x4D\x4D\x51\x51\x4F\x51\x4D\x20\x20\x20\x20\x4F\x51\x51\x4F\x36\x4F\x4F\x36\x4F\x4F\x51\x4F\x4F\x36\x36\x4F\x51\x4D\x4D",
+    "\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x49\x21\x21\x21\x7C\x36\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4F\x51\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4F\x36\x4F\x49\x49\x36\x4D\x36\x7C\x7C\x51\x4D\x4D\x49\x5E\x20\x7C\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x36\x2E\x4F\x20\x20\x4F\x4F\x4F\x36\x36\x4F\x51\x51\x4F\x4F\x51\x51\x4F\x4F\x36\x36\x51\x4D\x4D\x4D",
+    "\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x21\x7C\x36\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x36\x7C\x4F\x51\x4D\x36\x2E\x20\x20\x49\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x20\x51\x4D\x4F\x36\x49\x4F\x51\x4F\x51\x4F\x4F\x51\x51\x51\x4F\x36\x49\x51\x51\x4D\x4D\x4D",
+    "\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x49\x7C\x36\x36\x36\x49\x4D\x4D\x4D\x51\x5E\x2E\x20\x20\x20\x36\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x5E\x36\x49\x49\x49\x4F\x4F\x4F\x4F\x4D\x51\x4D\x51\x51\x4F\x49\x36\x51\x4D\x4D\x4D\x4D",
+    "\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x36\x49\x7C\x4D\x4D\x4D\x4F\x21\x20\x2E\x20\x20\x20\x2E\x2E\x7C\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4F\x4F\x36\x4F\x4F\x51\x51\x4D\x51\x51\x4D\x4F\x4D\x51\x4D\x51\x4D\x4D\x4D",
+    "\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x36\x49\x4F\x2E\x20\x51\x4D\x51\x51\x51\x51\x4F\x4F\x51\x4D\x4D\x51\x51\x51\x36\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D",
+    "\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x4F\x49\x21\x5E\x20\x77\x77\x77\x2E\x73\x65\x67\x6E\x61\x6C\x69\x64\x69\x76\x69\x74\x61\x2E\x63\x6F\x6D"
+};
+
+char *img2[L2] = {
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x21\x21\x36\x4F\x4F\x51\x51\x4F\x51\x4F\x7C\x2E\x2E\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x49\x5E\x2E\x2E\x49\x4F\x36\x4F\x4D\x51\x51\x4D\x51\x4D\x4D\x4D\x4D\x51\x4F\x51\x36\x21\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x4F\x51\x4F\x4F\x51\x4F\x51\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x51\x4D\x51\x7C\x5E\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x49\x51\x4F\x51\x51\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x51\x4F\x4D\x7C\x49\x49\x7C\x7C\x5E\x36\x49\x21\x7C\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x4F\x51\x4D\x4D\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x7C\x51\x51\x49\x36\x5E\x21\x36\x36\x21\x7C\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x2E\x49\x36\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x4D\x51\x51\x4F\x49\x36\x51\x4F\x7C\x7C\x21\x20\x20\x2E\x20\x20\x2E\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x7C\x36\x7C\x36\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x51\x51\x4F\x36\x4F\x49\x49\x36\x49\x49\x36\x36\x49\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x49\x36\x4F\x51\x4F\x4F\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x51\x51\x4F\x51\x4F\x4F\x4F\x4F\x5E\x7C\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x36\x51\x4F\x4F\x4F\x51\x51\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x51\x4F\x36\x4F\x51\x36\x51\x7C\x7C\x49\x21\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x49\x4F\x36\x36\x51\x4D\x4D\x51\x4D\x4F\x4D\x51\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x51\x51\x51\x51\x51\x51\x4F\x36\x4F\x4F\x36\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x36\x36\x4F\x51\x51\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x51\x4D\x4D\x51\x51\x4D\x4D\x4D\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x51\x51\x51\x51\x4F\x4F\x4F\x36\x49\x21\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x5E\x36\x4F\x51\x51\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x51\x4F\x4F\x36\x49\x7C\x21\x5E\x21\x5E\x21\x5E\x5E\x21\x21\x21\x21\x5E\x21\x21\x7C\x7C\x49\x36\x36\x4F\x4F\x51\x51\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4F\x36\x51\x36\x49\x21\x7C\x5E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x5E\x49\x51\x4F\x4F\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x51\x49\x7C\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x21\x7C\x21\x49\x49\x49\x4F\x36\x4F\x4F\x51\x4F\x4F\x51\x51\x51\x51\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x51\x4F\x4F\x4F\x4F\x36\x5E\x21\x21\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x7C\x36\x36\x4F\x51\x51\x4D\x51\x4D\x4D\x4D\x51\x4D\x36\x7C\x5E\x2E\x2E\x2E\x20\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x5E\x21\x5E\x21\x21\x21\x21\x7C\x7C\x49\x36\x4D\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4F\x49\x49\x7C\x5E\x5E\x21\x21\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x4F\x4F\x4D\x51\x51\x4D\x4D\x51\x4D\x51\x51\x49\x5E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x21\x7C\x36\x4D\x4D\x4D\x51\x4D\x51\x4D\x51\x49\x7C\x21\x5E\x5E\x2E\x20\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x36\x49\x49\x4F\x51\x51\x4D\x4D\x4D\x4D\x36\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x20\x2E\x2E\x5E\x5E\x7C\x51\x51\x51\x4D\x4D\x4D\x51\x4D\x51\x51\x4F\x4F\x7C\x5E\x5E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x4F\x51\x4D\x51\x4D\x51\x4D\x51\x21\x2E\x2E\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x20\x20\x2E\x2E\x2E\x5E\x5E\x51\x4D\x4D\x51\x4D\x51\x4D\x4F\x51\x4D\x51\x36\x36\x4F\x7C\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x49\x36\x51\x4D\x51\x51\x51\x4D\x36\x2E\x2E\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x5E\x49\x51\x51\x4D\x51\x4F\x4D\x36\x49\x36\x36\x4F\x49\x36\x49\x5E\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x36\x36\x4F\x51\x36\x36\x49\x21\x5E\x2E\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x5E\x5E\x49\x51\x51\x51\x51\x4F\x51\x36\x4F\x49\x7C\x36\x49\x49\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x2E\x7C\x36\x36\x36\x36\x49\x49\x7C\x5E\x2E\x2E\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x2E\x2E\x5E\x36\x51\x51\x51\x4D\x4F\x36\x36\x36\x51\x49\x21\x36\x49\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x36\x36\x4F\x4F\x7C\x7C\x21\x21\x5E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x20\x2E\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x20\x2E\x2E\x2E\x5E\x21\x49\x4F\x51\x4D\x51\x51\x4F\x51\x4F\x36\x36\x7C\x49\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x7C\x49\x36\x21\x49\x7C\x21\x5E\x2E\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x20\x2E\x20\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x2E\x20\x2E\x2E\x20\x2E\x20\x20\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x21\x49\x36\x4D\x51\x4D\x51\x51\x4D\x51\x51\x4F\x49\x21\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x51\x36\x49\x36\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x2E\x20\x2E\x2E\x2E\x5E\x20\x2E\x5E\x21\x2E\x20\x2E\x21\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x2E\x4F\x36\x4D\x4D\x51\x4D\x51\x4D\x51\x51\x49\x7C\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x51\x49\x36\x21\x21\x5E\x21\x2E\x5E\x5E\x2E\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x5E\x21\x5E\x21\x5E\x5E\x21\x7C\x21\x7C\x21\x5E\x5E\x5E\x49\x21\x2E\x2E\x21\x49\x21\x5E\x5E\x2E\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x2E\x2E\x2E\x20\x2E\x20\x20\x2E\x20\x20\x2E\x20\x20\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x21\x7C\x21\x51\x51\x4D\x51\x4D\x51\x4D\x4D\x4F\x7C\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x49\x4F\x7C\x21\x21\x5E\x21\x21\x21\x5E\x5E\x2E\x2E\x2E\x2E\x20\x20\x2E\x2E\x2E\x5E\x5E\x21\x7C\x7C\x7C\x49\x49\x49\x4F\x4F\x4F\x36\x4F\x4F\x4F\x4F\x36\x7C\x7C\x21\x21\x49\x5E\x5E\x5E\x21\x36\x36\x49\x49\x49\x49\x49\x7C\x7C\x21\x21\x5E\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x20\x20\x2E\x2E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x21\x2E\x21\x7C\x7C\x51\x51\x51\x4D\x51\x4D\x51\x4D\x36\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x49\x7C\x5E\x21\x21\x5E\x5E\x21\x5E\x21\x2E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x7C\x49\x36\x4F\x51\x4F\x4F\x51\x51\x51\x51\x51\x4D\x51\x51\x51\x51\x4F\x51\x4F\x36\x36\x49\x36\x5E\x5E\x5E\x21\x21\x51\x4F\x4F\x51\x4F\x51\x51\x51\x51\x51\x4D\x51\x51\x4F\x36\x36\x36\x7C\x7C\x21\x7C\x21\x21\x5E\x20\x2E\x20\x2E\x2E\x5E\x2E\x5E\x21\x7C\x7C\x49\x49\x21\x21\x7C\x49\x4F\x51\x4D\x51\x4D\x51\x51\x51\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x49\x36\x5E\x5E\x21\x21\x21\x36\x49\x7C\x21\x21\x2E\x2E\x2E\x2E\x5E\x21\x49\x4F\x4F\x4F\x36\x4F\x4F\x4F\x36\x4F\x4F\x51\x51\x51\x51\x51\x4D\x51\x51\x51\x51\x4F\x4F\x49\x21\x5E\x2E\x5E\x5E\x21\x36\x51\x4F\x51\x4F\x51\x51\x51\x4D\x51\x4D\x51\x51\x51\x51\x51\x4F\x4F\x4F\x36\x49\x49\x49\x21\x5E\x2E\x2E\x2E\x5E\x2E\x21\x5E\x21\x36\x49\x36\x49\x4F\x4F\x21\x5E\x21\x4F\x51\x4D\x51\x4D\x4D\x4F\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x36\x49\x5E\x7C\x7C\x36\x4F\x36\x36\x36\x21\x2E\x5E\x2E\x2E\x2E\x49\x4F\x36\x36\x21\x21\x21\x21\x7C\x49\x36\x4F\x51\x4F\x51\x51\x51\x51\x51\x51\x51\x51\x4F\x36\x49\x5E\x2E\x2E\x20\x2E\x2E\x2E\x7C\x4F\x51\x51\x51\x4D\x51\x51\x4D\x4D\x51\x51\x4F\x36\x36\x36\x49\x36\x49\x7C\x49\x49\x36\x36\x36\x7C\x21\x5E\x2E\x5E\x5E\x21\x7C\x36\x36\x49\x4F\x4F\x4F\x4F\x21\x5E\x21\x49\x36\x4F\x51\x51\x36\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x51\x7C\x21\x49\x49\x4F\x36\x51\x36\x7C\x5E\x5E\x5E\x2E\x2E\x7C\x36\x49\x7C\x21\x7C\x49\x4F\x51\x4F\x4F\x51\x51\x51\x36\x4F\x4F\x51\x4F\x51\x51\x4D\x51\x51\x36\x7C\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x49\x4F\x51\x4D\x51\x51\x4D\x51\x4D\x51\x51\x51\x51\x51\x51\x51\x4F\x36\x49\x49\x7C\x21\x7C\x4F\x36\x36\x7C\x5E\x2E\x5E\x21\x21\x49\x4F\x51\x4F\x51\x51\x4F\x36\x36\x7C\x49\x51\x4F\x51\x4F\x21\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x51\x49\x7C\x49\x4F\x4F\x51\x4F\x4F\x7C\x5E\x5E\x2E\x2E\x2E\x21\x21\x21\x7C\x4F\x4D\x51\x51\x51\x51\x51\x51\x4D\x51\x36\x7C\x7C\x4F\x4D\x51\x51\x4F\x4F\x4F\x7C\x5E\x2E\x20\x2E\x20\x2E\x20\x2E\x5E\x21\x36\x51\x51\x51\x51\x51\x51\x51\x4D\x51\x51\x4F\x51\x51\x4D\x51\x4F\x51\x51\x4F\x4F\x7C\x49\x49\x36\x49\x49\x21\x5E\x5E\x5E\x7C\x49\x36\x51\x4F\x51\x4F\x4F\x51\x49\x36\x4F\x51\x4D\x4F\x49\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x4F\x49\x7C\x51\x4F\x51\x4F\x36\x4F\x5E\x2E\x2E\x2E\x5E\x21\x7C\x49\x49\x49\x4D\x51\x51\x51\x36\x51\x51\x4D\x4D\x51\x36\x7C\x49\x36\x4F\x36\x36\x36\x36\x49\x5E\x5E\x20\x2E\x2E\x20\x20\x2E\x2E\x2E\x21\x21\x4F\x51\x51\x51\x4F\x4F\x51\x51\x4D\x51\x51\x4D\x51\x4F\x4F\x51\x51\x51\x4D\x51\x51\x7C\x7C\x49\x49\x49\x21\x21\x5E\x21\x21\x49\x36\x4F\x51\x51\x4F\x4F\x4D\x36\x49\x4F\x36\x4D\x51\x7C\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x4F\x7C\x7C\x4F\x4F\x36\x4F\x4F\x49\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x49\x4F\x4F\x36\x5E\x5E\x5E\x7C\x7C\x7C\x49\x49\x36\x7C\x7C\x7C\x49\x7C\x7C\x7C\x21\x5E\x2E\x2E\x2E\x20\x20\x2E\x20\x2E\x2E\x20\x2E\x2E\x5E\x21\x7C\x36\x49\x36\x36\x49\x21\x7C\x7C\x49\x49\x49\x7C\x21\x21\x21\x7C\x36\x4F\x51\x4F\x36\x36\x49\x49\x7C\x5E\x5E\x21\x21\x49\x36\x4F\x51\x51\x51\x36\x36\x51\x49\x49\x4D\x51\x4F\x7C\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x4F\x49\x49\x36\x36\x51\x4F\x36\x7C\x2E\x20\x2E\x2E\x5E\x5E\x5E\x21\x5E\x5E\x2E\x5E\x2E\x21\x21\x7C\x21\x5E\x21\x7C\x21\x7C\x7C\x7C\x49\x7C\x5E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x5E\x5E\x5E\x5E\x21\x36\x49\x49\x49\x36\x36\x49\x7C\x7C\x21\x21\x21\x5E\x5E\x5E\x5E\x21\x7C\x49\x49\x7C\x21\x7C\x21\x5E\x5E\x21\x7C\x49\x4F\x51\x51\x51\x49\x36\x51\x4F\x36\x4F\x4D\x51\x36\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7C\x36\x36\x4F\x36\x49\x4F\x4F\x7C\x2E\x2E\x2E\x20\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x5E\x5E\x21\x21\x21\x7C\x21\x7C\x21\x7C\x7C\x49\x7C\x21\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x21\x49\x36\x49\x7C\x7C\x7C\x7C\x49\x49\x36\x49\x7C\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x7C\x4F\x51\x4F\x51\x36\x36\x4F\x4F\x51\x4F\x4F\x4F\x49\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7C\x36\x51\x4F\x4F\x49\x51\x49\x5E\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x2E\x5E\x21\x21\x21\x21\x21\x49\x49\x49\x7C\x21\x5E\x5E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x7C\x49\x49\x49\x49\x49\x49\x7C\x7C\x21\x7C\x7C\x5E\x2E\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x5E\x2E\x5E\x21\x36\x51\x4F\x4F\x4F\x36\x4F\x51\x51\x4F\x4F\x7C\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7C\x51\x51\x51\x4F\x21\x21\x7C\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x2E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x2E\x5E\x21\x4F\x36\x36\x36\x4F\x36\x36\x51\x51\x51\x36\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x51\x51\x4F\x4F\x7C\x49\x21\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x20\x20\x2E\x20\x2E\x5E\x2E\x2E\x20\x2E\x2E\x2E\x5E\x5E\x21\x7C\x21\x7C\x21\x7C\x7C\x21\x5E\x5E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x36\x36\x36\x4F\x51\x36\x4F\x51\x51\x51\x51\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x4F\x51\x51\x4F\x5E\x21\x7C\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x2E\x2E\x5E\x21\x2E\x5E\x21\x21\x5E\x21\x7C\x49\x49\x49\x36\x36\x49\x36\x36\x36\x7C\x7C\x21\x21\x21\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x49\x4F\x4F\x36\x36\x4F\x51\x51\x51\x51\x51\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x5E\x5E\x5E\x21\x2E\x2E\x2E\x2E\x2E\x7C\x49\x21\x5E\x5E\x2E\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x5E\x7C\x7C\x21\x49\x36\x51\x51\x51\x51\x4D\x4F\x4F\x51\x4F\x51\x4F\x51\x51\x51\x51\x4D\x51\x4F\x4F\x49\x21\x21\x21\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x5E\x2E\x49\x36\x36\x36\x4F\x36\x51\x51\x4D\x51\x4F\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x49\x4F\x7C\x5E\x5E\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x5E\x49\x7C\x21\x5E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x21\x21\x5E\x5E\x49\x36\x51\x51\x4F\x4F\x4F\x4F\x36\x4F\x51\x51\x51\x51\x51\x51\x51\x4D\x51\x51\x4F\x36\x7C\x21\x21\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x49\x36\x49\x36\x4F\x4F\x51\x4D\x51\x36\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x51\x4F\x51\x7C\x7C\x21\x21\x5E\x2E\x2E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x21\x5E\x7C\x36\x36\x4F\x4F\x51\x51\x4F\x51\x51\x51\x51\x51\x4F\x4F\x4F\x4F\x51\x4F\x21\x21\x5E\x5E\x21\x21\x5E\x2E\x5E\x2E\x2E\x2E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x49\x36\x36\x4F\x36\x36\x36\x49\x36\x51\x51\x4F\x4F\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x51\x51\x4F\x5E\x7C\x49\x7C\x5E\x2E\x2E\x2E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x5E\x2E\x5E\x2E\x2E\x5E\x21\x36\x36\x4F\x4F\x4F\x4F\x4F\x51\x51\x4F\x4F\x4F\x36\x36\x49\x36\x21\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x21\x5E\x21\x21\x21\x5E\x21\x49\x49\x49\x36\x49\x49\x49\x4F\x36\x51\x51\x51\x51\x49\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x7C\x4F\x4F\x7C\x5E\x2E\x49\x7C\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x20\x2E\x5E\x7C\x21\x5E\x5E\x2E\x2E\x5E\x2E\x2E\x21\x7C\x7C\x21\x49\x49\x36\x36\x36\x7C\x36\x4F\x4F\x4F\x4F\x51\x51\x4F\x36\x36\x36\x49\x36\x49\x49\x5E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x5E\x21\x49\x49\x49\x49\x36\x49\x36\x51\x51\x51\x4F\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x4F\x7C\x2E\x5E\x7C\x49\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x5E\x7C\x21\x21\x20\x5E\x2E\x5E\x5E\x2E\x21\x7C\x7C\x49\x49\x7C\x49\x36\x36\x7C\x4F\x49\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x36\x36\x49\x4F\x4F\x36\x4F\x21\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x5E\x5E\x21\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x2E\x5E\x49\x36\x49\x5E\x21\x5E\x5E\x4F\x4F\x51\x36\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x21\x36\x2E\x21\x7C\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x21\x21\x7C\x2E\x2E\x2E\x21\x7C\x7C\x7C\x7C\x36\x49\x49\x49\x36\x7C\x7C\x21\x5E\x21\x21\x7C\x21\x5E\x21\x21\x5E\x5E\x21\x7C\x7C\x49\x49\x36\x49\x49\x36\x49\x49\x7C\x7C\x5E\x5E\x21\x2E\x5E\x2E\x5E\x21\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x5E\x5E\x2E\x2E\x20\x4F\x51\x4F\x7C\x21\x5E\x7C\x4F\x36\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x2E\x49\x5E\x7C\x36\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x5E\x21\x21\x21\x5E\x2E\x5E\x7C\x49\x49\x49\x49\x49\x4F\x4F\x4F\x36\x36\x49\x36\x4F\x4F\x51\x51\x4F\x4F\x51\x36\x4F\x4F\x4F\x4F\x51\x36\x7C\x7C\x7C\x49\x4F\x4F\x51\x36\x36\x49\x21\x21\x21\x21\x5E\x2E\x5E\x21\x21\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x2E\x7C\x51\x4F\x36\x49\x49\x21\x49\x7C\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x2E\x5E\x21\x7C\x21\x5E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x5E\x2E\x21\x7C\x36\x36\x4F\x4F\x4F\x51\x51\x4D\x51\x4F\x49\x7C\x21\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x49\x49\x4F\x4F\x51\x51\x51\x36\x36\x51\x4F\x51\x4F\x36\x36\x7C\x49\x7C\x21\x2E\x5E\x7C\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x21\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x5E\x5E\x5E\x21\x36\x4F\x4F\x36\x4F\x49\x21\x21\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x20\x2E\x2E\x2E\x21\x49\x7C\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x49\x36\x49\x49\x36\x4F\x51\x51\x4F\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x7C\x36\x49\x7C\x7C\x7C\x21\x7C\x21\x21\x5E\x21\x21\x7C\x36\x4F\x51\x51\x51\x51\x4F\x4F\x4F\x36\x49\x36\x7C\x5E\x5E\x5E\x5E\x21\x21\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x7C\x36\x36\x49\x7C\x7C\x21\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x20\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x5E\x5E\x5E\x2E\x5E\x21\x5E\x21\x49\x4F\x4F\x36\x49\x7C\x21\x21\x5E\x21\x21\x7C\x21\x7C\x36\x49\x49\x4F\x4F\x4F\x4F\x51\x51\x4F\x36\x49\x49\x7C\x7C\x49\x7C\x49\x49\x49\x51\x51\x51\x4F\x4F\x49\x36\x49\x7C\x5E\x5E\x5E\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x7C\x21\x21\x21\x7C\x7C\x49\x7C\x5E\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x5E\x49\x49\x36\x20\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x21\x21\x4F\x36\x4F\x49\x5E\x5E\x21\x21\x5E\x5E\x7C\x7C\x49\x4F\x36\x36\x36\x49\x4F\x4F\x4F\x4D\x51\x36\x51\x36\x4F\x4F\x36\x36\x49\x7C\x49\x49\x7C\x49\x51\x51\x4F\x51\x4F\x49\x21\x5E\x5E\x5E\x5E\x7C\x7C\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x21\x21\x7C\x5E\x5E\x2E\x2E\x20\x2E\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x21\x7C\x5E\x2E\x2E\x5E\x5E\x2E\x2E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x49\x36\x36\x4F\x36\x49\x49\x7C\x7C\x21\x5E\x21\x21\x21\x21\x49\x36\x4F\x36\x4F\x4F\x4F\x4F\x36\x4F\x51\x36\x4F\x4F\x4F\x36\x36\x49\x49\x7C\x7C\x49\x36\x36\x36\x4F\x4F\x49\x7C\x7C\x7C\x21\x5E\x21\x21\x21\x7C\x7C\x21\x5E\x21\x5E\x21\x5E\x5E\x2E\x5E\x5E\x21\x2E\x7C\x49\x36\x36\x49\x21\x7C\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x21\x36\x49\x49\x4F\x4F\x7C\x49\x49\x7C\x7C\x21\x21\x5E\x7C\x7C\x49\x21\x7C\x7C\x7C\x49\x49\x49\x36\x4F\x4F\x36\x7C\x49\x21\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x49\x36\x49\x4F\x4F\x36\x7C\x7C\x21\x5E\x5E\x7C\x21\x21\x21\x7C\x21\x21\x5E\x5E\x5E\x5E\x5E\x2E\x4F\x36\x21\x20\x5E\x7C\x7C\x21\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x21\x21\x7C\x49\x7C\x36\x5E\x5E\x21\x7C\x49\x7C\x21\x5E\x21\x2E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x21\x21\x7C\x21\x21\x21\x49\x7C\x36\x49\x7C\x49\x36\x49\x4F\x36\x51\x51\x49\x7C\x7C\x7C\x21\x7C\x21\x21\x21\x21\x7C\x21\x7C\x5E\x5E\x5E\x21\x7C\x4F\x4F\x49\x2E\x20\x2E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x5E\x5E\x21\x5E\x5E\x5E\x21\x5E\x21\x21\x5E\x5E\x21\x7C\x21\x7C\x7C\x49\x21\x21\x7C\x7C\x5E\x5E\x21\x5E\x21\x21\x21\x7C\x7C\x5E\x5E\x21\x5E\x21\x5E\x2E\x2E\x2E\x5E\x5E\x21\x5E\x5E\x21\x49\x7C\x49\x21\x7C\x49\x36\x51\x4F\x4F\x4F\x4F\x36\x7C\x49\x7C\x7C\x7C\x21\x7C\x7C\x21\x21\x21\x7C\x21\x21\x21\x21\x20\x5E\x4F\x7C\x21\x5E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x5E\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x21\x5E\x21\x21\x21\x49\x7C\x7C\x5E\x21\x5E\x49\x21\x21\x21\x7C\x21\x7C\x7C\x21\x21\x21\x21\x21\x5E\x21\x21\x7C\x5E\x5E\x5E\x5E\x21\x21\x5E\x7C\x49\x49\x36\x49\x7C\x7C\x36\x51\x51\x51\x4F\x7C\x7C\x49\x7C\x49\x7C\x7C\x21\x7C\x7C\x7C\x7C\x49\x21\x21\x7C\x20\x20\x20\x2E\x21\x21\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x21\x5E\x21\x21\x5E\x5E\x5E\x5E\x2E\x5E\x7C\x7C\x21\x7C\x7C\x21\x21\x7C\x49\x7C\x49\x21\x49\x7C\x7C\x21\x7C\x49\x21\x49\x49\x36\x7C\x7C\x21\x49\x7C\x7C\x7C\x7C\x7C\x21\x21\x21\x21\x49\x7C\x7C\x7C\x21\x49\x4F\x51\x4F\x36\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x7C\x49\x49\x49\x49\x7C\x21\x21\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x5E\x21\x21\x7C\x21\x21\x21\x5E\x21\x21\x21\x49\x7C\x21\x5E\x2E\x2E\x5E\x21\x7C\x5E\x7C\x21\x4F\x7C\x36\x49\x36\x36\x36\x49\x36\x4F\x36\x21\x7C\x49\x21\x7C\x7C\x21\x21\x21\x49\x5E\x21\x5E\x7C\x21\x7C\x5E\x7C\x49\x36\x4F\x21\x7C\x7C\x7C\x21\x7C\x7C\x7C\x49\x49\x49\x49\x49\x7C\x21\x21\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x21\x7C\x49\x7C\x7C\x21\x7C\x5E\x21\x21\x7C\x7C\x7C\x5E\x7C\x21\x21\x21\x49\x7C\x51\x4F\x49\x4F\x4F\x36\x4F\x36\x36\x4F\x4F\x4F\x36\x36\x49\x49\x49\x49\x49\x7C\x36\x49\x49\x36\x36\x49\x4F\x36\x49\x21\x5E\x36\x4F\x36\x49\x49\x49\x49\x49\x7C\x49\x49\x36\x36\x49\x49\x49\x21\x21\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x7C\x7C\x49\x49\x49\x7C\x7C\x7C\x7C\x36\x36\x36\x7C\x21\x5E\x36\x49\x7C\x7C\x4F\x51\x49\x36\x4F\x51\x51\x51\x51\x51\x4F\x51\x4F\x51\x4F\x4F\x49\x51\x4F\x4F\x7C\x36\x49\x49\x49\x36\x21\x49\x7C\x7C\x36\x36\x7C\x4F\x36\x49\x49\x36\x36\x49\x49\x49\x36\x49\x36\x49\x49\x7C\x21\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x21\x21\x7C\x49\x36\x49\x7C\x49\x49\x36\x49\x36\x36\x36\x49\x36\x7C\x36\x4F\x36\x51\x4F\x36\x51\x51\x4D\x4F\x51\x4F\x4F\x4F\x4D\x4D\x4F\x51\x51\x51\x4F\x51\x36\x4F\x4F\x36\x49\x49\x7C\x36\x7C\x36\x36\x4F\x4F\x4F\x36\x4F\x4F\x4F\x4F\x36\x49\x36\x4F\x4F\x36\x36\x21\x21\x5E\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x7C\x21\x21\x7C\x49\x36\x49\x36\x4F\x51\x51\x4F\x4F\x4F\x4F\x4F\x4D\x51\x4D\x36\x51\x4F\x4F\x51\x51\x51\x4D\x51\x51\x51\x4D\x51\x4F\x51\x51\x4F\x4F\x51\x51\x51\x51\x4F\x4F\x51\x4F\x36\x51\x4F\x4F\x4F\x4F\x51\x51\x4F\x4F\x51\x4F\x4F\x36\x36\x36\x36\x49\x49\x7C\x21\x5E\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x5E\x2E\x5E\x2E\x5E\x49\x21\x21\x7C\x7C\x49\x7C\x49\x4F\x4F\x51\x36\x51\x51\x51\x51\x51\x4D\x4D\x51\x51\x4D\x51\x4D\x51\x4D\x51\x51\x51\x4D\x4D\x51\x51\x4D\x51\x51\x4D\x51\x51\x4D\x51\x51\x51\x51\x4F\x4F\x51\x51\x51\x51\x51\x4F\x4F\x4F\x4F\x36\x7C\x49\x49\x49\x49\x7C\x21\x5E\x5E\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x21\x51\x4F\x5E\x5E\x2E\x21\x49\x7C\x21\x21\x7C\x49\x49\x49\x36\x36\x36\x4F\x4F\x51\x51\x51\x51\x4D\x51\x51\x4D\x51\x4D\x51\x4D\x51\x51\x4D\x51\x4D\x4D\x51\x51\x4D\x51\x4D\x51\x4D\x51\x51\x4D\x4D\x51\x51\x51\x4F\x51\x51\x4F\x4F\x4F\x36\x36\x49\x49\x7C\x7C\x49\x7C\x7C\x21\x5E\x5E\x2E\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x2E\x7C\x36\x36\x4F\x49\x7C\x5E\x7C\x49\x7C\x21\x7C\x49\x49\x7C\x49\x36\x36\x36\x4F\x51\x4F\x51\x51\x51\x4D\x51\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x51\x51\x51\x4F\x51\x4F\x36\x4F\x36\x36\x49\x49\x7C\x21\x7C\x7C\x7C\x21\x21\x5E\x5E\x5E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x7C\x21\x7C\x51\x4F\x51\x51\x51\x51\x51\x51\x51\x4F\x36\x36\x49\x36\x36\x36\x4F\x4F\x4F\x51\x4F\x51\x51\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x51\x51\x4F\x4F\x4F\x36\x36\x36\x36\x36\x36\x49\x7C\x7C\x7C\x7C\x7C\x7C\x21\x5E\x21\x21\x2E\x5E\x7C\x21\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x7C\x36\x7C\x51\x51\x4D\x51\x51\x4D\x51\x51\x51\x51\x51\x4D\x51\x4D\x51\x51\x4F\x4F\x51\x51\x51\x51\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x51\x4D\x4D\x51\x51\x4F\x4F\x4F\x4F\x4F\x4F\x36\x4F\x36\x4F\x36\x49\x49\x7C\x7C\x7C\x7C\x21\x21\x21\x21\x5E\x21\x2E\x36\x4F\x49\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x7C\x36\x21\x4F\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x51\x4D\x51\x51\x51\x36\x4F\x4F\x4F\x4F\x4F\x4F\x36\x36\x49\x49\x7C\x7C\x49\x7C\x21\x7C\x7C\x21\x7C\x21\x7C\x36\x36\x4F\x36\x36\x7C\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x2E\x5E\x21\x36\x21\x4F\x4D\x51\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x51\x4F\x51\x51\x51\x4F\x4F\x36\x36\x4F\x4F\x36\x4F\x36\x36\x4F\x49\x49\x7C\x49\x49\x21\x49\x4F\x36\x51\x51\x51\x51\x4F\x4F\x51\x4F\x36\x49\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x21\x21\x2E\x4F\x7C\x21\x51\x51\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x51\x4D\x4D\x4D\x51\x51\x4D\x51\x4D\x4D\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x4F\x4D\x51\x51\x51\x51\x36\x49\x21\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x0D",
+    "\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x20\x5E\x5E\x21\x4F\x49\x36\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x20\x77\x77\x77\x2E\x73\x65\x67\x6E\x61\x6C\x69\x64\x69\x76\x69\x74\x61\x2E\x63\x6F\x6D\x20\x5E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"
+};
+
+char *img3[L3] = {
+"\x2E\x5E\x5E\x21\x5E\x7C\x7C\x5E\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x5E\x5E\x21\x21\x7C\x36\x7C\x49\x7C\x49\x7C\x21\x49\x49\x49\x7C\x49\x49\x7C",
+"\x2E\x5E\x2E\x2E\x5E\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x21\x5E\x5E\x21\x5E\x5E\x21\x5E\x7C\x21\x7C\x21\x21\x49\x49\x21\x21\x7C\x49\x49\x7C\x21\x5E",
+"\x2E\x2E\x2E\x5E\x2E\x7C\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x21\x5E\x21\x21\x49\x7C\x7C\x7C\x49\x21\x21\x49\x7C\x7C\x21",
+"\x2E\x2E\x2E\x5E\x21\x7C\x21\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x21\x21\x21\x21\x5E\x21\x21\x7C\x5E\x49\x7C\x7C\x21\x7C",
+"\x2E\x2E\x2E\x2E\x5E\x21\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x5E\x21\x5E\x5E\x7C\x21\x21",
+"\x2E\x2E\x2E\x2E\x21\x21\x5E\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x5E",
+"\x2E\x2E\x2E\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x21\x5E\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x2E\x2E\x2E",
+"\x5E\x2E\x5E\x21\x7C\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x7C\x21\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E",
+"\x5E\x2E\x5E\x21\x7C\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x21\x21\x7C\x21\x7C\x21\x7C\x21\x21\x7C\x21\x7C\x7C\x7C\x21\x21\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E",
+"\x5E\x5E\x5E\x5E\x21\x21\x21\x5E\x21\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x7C\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x7C\x49\x49\x36\x49\x7C\x7C\x7C\x21\x7C\x7C\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20",
+"\x2E\x5E\x5E\x21\x21\x5E\x21\x21\x21\x5E\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x21\x21\x7C\x7C\x7C\x7C\x49\x49\x49\x49\x36\x36\x36\x36\x4F\x36\x36\x4F\x36\x36\x36\x49\x36\x36\x49\x49\x49\x36\x49\x7C\x7C\x7C\x21\x21\x21\x5E\x21\x21\x5E\x2E\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x20\x20\x20",
+"\x5E\x5E\x5E\x5E\x21\x21\x7C\x21\x21\x21\x7C\x21\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x49\x36\x36\x4F\x51\x4F\x51\x51\x51\x4F\x51\x4D\x51\x51\x4F\x4F\x4F\x36\x49\x7C\x7C\x21\x21\x21\x21\x21\x21\x5E\x5E\x21\x5E\x5E\x5E\x2E\x2E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x20\x2E\x20\x20",
+"\x21\x5E\x5E\x21\x21\x36\x36\x4F\x49\x49\x49\x36\x7C\x49\x7C\x7C\x7C\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x49\x36\x49\x4F\x36\x4F\x51\x4F\x51\x4F\x51\x51\x51\x4F\x4F\x4F\x4F\x49\x7C\x7C\x7C\x21\x7C\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x2E\x2E\x5E\x2E\x2E\x20\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x20",
+"\x7C\x7C\x21\x7C\x7C\x21\x21\x7C\x4F\x51\x51\x4F\x51\x51\x4F\x4F\x51\x4F\x49\x49\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x49\x7C\x36\x36\x36\x4F\x4F\x36\x4F\x51\x4F\x4F\x4F\x36\x36\x49\x49\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x21\x7C\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x20\x20\x20",
+"\x21\x5E\x21\x7C\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x36\x4F\x4F\x4F\x51\x4F\x51\x51\x36\x49\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x49\x49\x36\x4F\x4F\x36\x4F\x36\x36\x36\x36\x36\x49\x49\x49\x7C\x49\x7C\x49\x49\x36\x49\x49\x49\x49\x49\x49\x49\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x20\x20\x2E\x20\x20\x2E",
+"\x2E\x21\x5E\x5E\x21\x21\x5E\x5E\x21\x21\x21\x7C\x21\x7C\x21\x21\x49\x4F\x51\x4F\x4F\x4F\x4F\x49\x7C\x7C\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x36\x49\x49\x36\x4F\x36\x36\x49\x36\x49\x49\x49\x49\x49\x49\x36\x36\x36\x36\x51\x51\x51\x51\x4D\x51\x4D\x4D\x51\x51\x51\x4F\x4F\x4F\x36\x36\x36\x36\x49\x7C\x7C\x21\x7C\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x21\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20",
+"\x5E\x2E\x5E\x2E\x5E\x5E\x21\x21\x21\x21\x7C\x49\x36\x4F\x36\x4F\x4F\x49\x36\x49\x36\x36\x4F\x49\x36\x49\x49\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x7C\x7C\x7C\x49\x7C\x7C\x49\x7C\x49\x49\x36\x49\x49\x36\x4F\x36\x51\x51\x51\x51\x51\x51\x51\x4F\x4F\x51\x4F\x51\x4F\x4F\x4F\x51\x51\x51\x4D\x51\x4D\x51\x4F\x36\x36\x49\x7C\x7C\x21\x7C\x21\x5E\x21\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x20\x2E\x20",
+"\x2E\x5E\x5E\x5E\x2E\x5E\x21\x21\x7C\x49\x51\x4F\x4F\x49\x21\x36\x5E\x51\x4F\x51\x4F\x4D\x51\x51\x7C\x49\x49\x7C\x7C\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x21\x7C\x7C\x7C\x7C\x49\x49\x49\x36\x36\x36\x36\x36\x4F\x51\x51\x4F\x4F\x4F\x4F\x51\x4F\x49\x51\x51\x51\x51\x4F\x51\x4D\x4D\x51\x36\x49\x51\x36\x36\x51\x4D\x51\x4F\x36\x36\x49\x49\x7C\x7C\x21\x5E\x5E\x5E\x21\x5E\x5E\x2E\x21\x5E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x20",
+"\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x21\x51\x36\x51\x4D\x4D\x51\x51\x4D\x4F\x4F\x51\x4D\x51\x4D\x51\x51\x51\x4D\x4F\x49\x7C\x21\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x49\x36\x36\x36\x4F\x4F\x36\x4F\x4F\x51\x4F\x51\x4F\x51\x49\x51\x4D\x51\x4F\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4F\x51\x7C\x49\x36\x4D\x51\x51\x36\x49\x49\x7C\x7C\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x20\x2E\x2E",
+"\x2E\x5E\x2E\x5E\x21\x7C\x7C\x36\x4D\x4D\x51\x51\x36\x49\x21\x5E\x5E\x51\x7C\x20\x4F\x51\x4D\x4D\x4D\x4D\x4F\x36\x4F\x51\x36\x49\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x49\x49\x49\x36\x4F\x4F\x4F\x4F\x4F\x36\x4F\x51\x4F\x36\x51\x51\x4D\x4D\x36\x20\x20\x7C\x51\x4F\x4F\x51\x4D\x51\x4D\x4D\x51\x4F\x4D\x7C\x4F\x51\x51\x51\x4F\x36\x4F\x51\x49\x49\x49\x7C\x7C\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x20\x2E\x20\x20\x20",
+"\x5E\x2E\x5E\x2E\x2E\x5E\x5E\x5E\x7C\x49\x36\x36\x49\x5E\x2E\x2E\x5E\x51\x4F\x51\x4F\x51\x4D\x4D\x51\x4F\x51\x51\x51\x36\x36\x4F\x7C\x21\x5E\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x7C\x7C\x36\x36\x4F\x4F\x4F\x4F\x51\x4F\x51\x51\x4F\x4F\x51\x4D\x51\x36\x49\x5E\x2E\x5E\x5E\x4D\x49\x36\x49\x4F\x51\x36\x4F\x36\x36\x21\x5E\x2E\x4F\x49\x2E\x7C\x4F\x4F\x36\x49\x49\x49\x7C\x7C\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x2E\x2E\x20\x20\x20",
+"\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x2E\x5E\x21\x7C\x7C\x21\x5E\x5E\x5E\x21\x51\x51\x51\x4F\x51\x4F\x51\x51\x4D\x51\x51\x51\x51\x7C\x49\x7C\x5E\x5E\x5E\x21\x5E\x21\x21\x21\x21\x21\x7C\x7C\x49\x36\x4F\x4F\x51\x51\x4F\x51\x51\x4F\x51\x4D\x4F\x4F\x36\x36\x7C\x5E\x5E\x5E\x5E\x5E\x7C\x51\x51\x4F\x51\x4F\x51\x51\x4F\x36\x49\x7C\x5E\x49\x5E\x5E\x7C\x21\x21\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x20\x2E\x2E\x20\x20",
+"\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x2E\x5E\x5E\x7C\x49\x49\x7C\x36\x7C\x21\x5E\x5E\x21\x4F\x51\x4D\x51\x4F\x36\x36\x4F\x4F\x4F\x36\x36\x7C\x21\x21\x5E\x5E\x5E\x5E\x21\x21\x21\x5E\x2E\x21\x7C\x49\x49\x36\x36\x4F\x4F\x4F\x4F\x4D\x51\x51\x4F\x4F\x36\x36\x36\x49\x7C\x7C\x49\x49\x49\x49\x49\x7C\x7C\x49\x49\x36\x49\x36\x7C\x21\x21\x7C\x49\x5E\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x21\x7C\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x20\x20\x2E\x20",
+"\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x2E\x5E\x21\x7C\x36\x4F\x4F\x49\x21\x21\x49\x49\x36\x36\x51\x4F\x4F\x4F\x36\x36\x36\x49\x49\x7C\x21\x21\x5E\x5E\x5E\x21\x5E\x21\x21\x21\x5E\x5E\x21\x21\x7C\x49\x49\x36\x4F\x36\x36\x36\x36\x4F\x36\x4F\x49\x49\x36\x36\x36\x36\x51\x4F\x51\x4F\x51\x36\x4F\x51\x4F\x4D\x36\x49\x7C\x7C\x7C\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x20\x20\x20\x20",
+"\x2E\x5E\x5E\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x21\x21\x49\x21\x49\x49\x4F\x36\x49\x49\x36\x49\x36\x49\x49\x49\x49\x49\x7C\x7C\x49\x7C\x7C\x21\x5E\x5E\x5E\x21\x21\x21\x5E\x21\x5E\x21\x21\x7C\x7C\x7C\x49\x49\x36\x36\x36\x4F\x36\x36\x49\x49\x49\x49\x49\x7C\x7C\x7C\x49\x49\x36\x49\x49\x49\x36\x7C\x49\x49\x7C\x49\x7C\x7C\x21\x7C\x21\x21\x21\x21\x7C\x21\x21\x7C\x21\x7C\x7C\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x20\x20\x20\x20",
+"\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x5E\x5E\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x21\x21\x5E\x5E\x21\x21\x21\x21\x21\x5E\x21\x21\x5E\x21\x21\x7C\x21\x7C\x7C\x49\x36\x36\x36\x49\x49\x49\x49\x7C\x49\x7C\x7C\x49\x49\x7C\x7C\x49\x49\x7C\x7C\x49\x49\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x7C\x21\x7C\x21\x7C\x21\x21\x7C\x21\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x2E\x2E\x20\x2E\x20\x2E\x2E\x20",
+"\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x21\x21\x5E\x5E\x21\x21\x5E\x21\x21\x7C\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x21\x21\x21\x21\x5E\x5E\x21\x5E\x21\x21\x21\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x7C\x7C\x7C\x49\x7C\x49\x49\x49\x49\x49\x49\x49\x7C\x49\x49\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x7C\x7C\x21\x7C\x7C\x21\x7C\x7C\x21\x21\x7C\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E",
+"\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x21\x5E\x21\x21\x5E\x21\x21\x21\x5E\x21\x21\x21\x21\x7C\x7C\x7C\x7C\x21\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x5E\x5E\x5E\x2E\x5E\x5E\x21\x21\x21\x21\x21\x21\x7C\x7C\x7C\x49\x7C\x49\x49\x49\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x7C\x21\x7C\x21\x21\x7C\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E",
+"\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x21\x5E\x21\x21\x5E\x5E\x5E\x21\x5E\x21\x21\x21\x5E\x5E\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x7C\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E",
+"\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x5E\x21\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x21\x21\x21\x21\x21\x5E\x5E\x2E\x20\x2E\x2E\x2E\x5E\x5E\x21\x21\x21\x21\x21\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E",
+"\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x21\x21\x21\x21\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x21\x21\x7C\x21\x21\x7C\x7C\x7C\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x7C\x21\x7C\x21\x7C\x21\x21\x7C\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E",
+"\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x21\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x5E\x21\x21\x21\x7C\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x7C\x7C\x21\x7C\x21\x7C\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x2E",
+"\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x21\x21\x21\x5E\x21\x21\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x21\x21\x21\x7C\x21\x5E\x21\x5E\x5E\x2E\x2E\x2E\x20\x2E\x5E\x5E\x5E\x5E\x21\x21\x21\x7C\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x7C\x21\x7C\x21\x7C\x7C\x21\x7C\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x2E",
+"\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x21\x21\x21\x21\x21\x21\x21\x5E\x5E\x21\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x21\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x7C\x21\x7C\x7C\x21\x7C\x21\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E",
+"\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x21\x5E\x21\x21\x21\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x5E\x5E\x21\x5E\x5E\x7C\x21\x7C\x21\x21\x21\x5E\x5E\x5E\x2E\x2E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x21\x49\x36\x49\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x2E",
+"\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x21\x5E\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x5E\x2E\x5E\x2E\x5E\x21\x21\x21\x5E\x5E\x2E\x5E\x5E\x5E\x36\x36\x36\x49\x49\x7C\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E",
+"\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x5E\x5E\x21\x5E\x2E\x5E\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x49\x4F\x36\x36\x49\x49\x49\x49\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E",
+"\x2E\x2E\x2E\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x20\x2E\x5E\x7C\x36\x4F\x4F\x36\x36\x49\x49\x7C\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x7C\x21\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E",
+"\x21\x21\x21\x7C\x7C\x7C\x7C\x7C\x49\x7C\x21\x21\x5E\x2E\x2E\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x2E\x36\x36\x4F\x36\x36\x36\x49\x49\x49\x7C\x49\x7C\x7C\x49\x7C\x7C\x7C\x7C\x21\x7C\x21\x21\x7C\x21\x7C\x7C\x21\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x21\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E",
+"\x7C\x49\x49\x49\x36\x36\x36\x4F\x4F\x36\x7C\x21\x5E\x5E\x2E\x2E\x5E\x21\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x5E\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x5E\x21\x21\x5E\x7C\x4F\x51\x51\x51\x4F\x36\x7C\x21\x21\x36\x49\x36\x36\x36\x36\x36\x36\x36\x49\x49\x49\x7C\x49\x49\x7C\x7C\x7C\x7C\x7C\x21\x7C\x7C\x21\x21\x7C\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E",
+"\x36\x4F\x4F\x4F\x51\x51\x51\x4F\x4F\x4F\x49\x7C\x21\x5E\x5E\x5E\x2E\x5E\x21\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x5E\x21\x21\x21\x7C\x7C\x21\x21\x7C\x21\x21\x5E\x7C\x7C\x49\x7C\x7C\x49\x49\x7C\x49\x49\x49\x49\x49\x49\x36\x49\x49\x36\x49\x36\x36\x49\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x21\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21",
+"\x4F\x4F\x51\x51\x51\x4D\x51\x51\x51\x4F\x4F\x4F\x7C\x21\x21\x5E\x5E\x2E\x5E\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x5E\x21\x21\x7C\x49\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x7C\x49\x7C\x49\x49\x49\x49\x49\x49\x7C\x49\x49\x49\x49\x49\x49\x49\x49\x7C\x49\x49\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x21\x21",
+"\x51\x51\x51\x4D\x51\x4D\x4D\x51\x51\x51\x51\x4F\x36\x49\x7C\x21\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x5E\x21\x5E\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x49\x7C\x7C\x7C\x49\x7C\x49\x7C\x49\x7C\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21",
+"\x4F\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x51\x51\x4F\x4F\x36\x49\x7C\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x7C\x7C\x49\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x7C\x49\x49\x7C\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x21\x7C\x21\x21\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C",
+"\x51\x51\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x51\x51\x4F\x4F\x36\x36\x7C\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x21\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x7C\x7C\x49",
+"\x51\x4D\x51\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x51\x4F\x51\x4F\x36\x36\x36\x49\x7C\x21\x7C\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x49\x49\x7C\x7C\x7C\x21\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x49\x36\x36",
+"\x4D\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x4D\x51\x51\x51\x4F\x51\x4F\x4F\x36\x49\x36\x7C\x7C\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x7C\x7C\x7C\x5E\x7C\x7C\x7C\x21\x21\x5E\x5E\x49\x49\x49\x49\x49\x7C\x7C\x21\x21\x21\x21\x21\x21\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x49\x7C\x7C\x7C\x49\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x36\x49\x36\x36",
+"\x4D\x51\x51\x4D\x51\x4D\x4D\x51\x4D\x4D\x51\x51\x4F\x4F\x4F\x4F\x36\x36\x36\x49\x7C\x7C\x21\x7C\x21\x21\x21\x21\x21\x7C\x49\x36\x49\x49\x36\x36\x36\x36\x36\x36\x36\x49\x49\x4F\x4F\x36\x4F\x4F\x36\x36\x4F\x4F\x36\x4F\x36\x36\x36\x36\x49\x49\x7C\x21\x21\x7C\x49\x36\x36\x49\x36\x49\x49\x49\x49\x7C\x49\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x21\x21\x21\x7C\x21\x7C\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x49\x49\x36\x36\x4F\x4F",
+"\x51\x51\x4D\x51\x51\x51\x51\x51\x51\x4F\x51\x4F\x4F\x4F\x36\x36\x36\x49\x49\x36\x49\x49\x7C\x7C\x21\x21\x21\x21\x7C\x7C\x49\x49\x7C\x49\x4F\x4F\x51\x51\x51\x4F\x4F\x4F\x4F\x4F\x51\x51\x4F\x4F\x4F\x4F\x51\x4F\x4F\x51\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x4D\x51\x51\x36\x49\x49\x49\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x7C\x21\x21\x7C\x21\x21\x7C\x21\x7C\x7C\x21\x7C\x7C\x7C\x7C\x7C\x49\x49\x49\x49\x49\x36\x36\x36\x51\x4F\x4F\x4F",
+"\x4F\x51\x4F\x4F\x51\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x36\x36\x36\x49\x36\x49\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x21\x21\x7C\x21\x21\x21\x7C\x4F\x36\x36\x4F\x4F\x4F\x4F\x51\x4F\x51\x51\x4D\x51\x4D\x51\x51\x51\x51\x4F\x51\x51\x51\x51\x51\x4F\x4F\x51\x4F\x4F\x51\x4F\x36\x36\x49\x36\x4F\x36\x49\x49\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x7C\x21\x7C\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x49\x49\x49\x36\x36\x4F\x51\x4F\x4F\x4F\x4F",
+"\x4F\x4F\x36\x4F\x36\x4F\x36\x36\x36\x36\x36\x36\x36\x36\x36\x49\x49\x49\x49\x49\x49\x49\x49\x49\x49\x7C\x21\x7C\x21\x21\x7C\x21\x21\x21\x49\x36\x49\x49\x36\x36\x36\x4F\x4F\x4F\x51\x4F\x36\x4F\x4F\x4F\x36\x36\x36\x36\x49\x4F\x49\x36\x49\x36\x36\x36\x49\x7C\x5E\x21\x21\x7C\x49\x7C\x49\x49\x7C\x49\x7C\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x7C\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x49\x49\x49\x36\x36\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F",
+"\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x49\x36\x49\x49\x36\x49\x36\x36\x49\x49\x36\x49\x49\x7C\x21\x21\x21\x21\x21\x21\x21\x7C\x49\x49\x7C\x49\x36\x49\x36\x49\x36\x36\x36\x36\x36\x49\x49\x49\x36\x36\x36\x36\x4F\x49\x36\x36\x49\x7C\x21\x21\x21\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x7C\x49\x49\x36\x49\x36\x36\x4F\x4F\x51\x4F\x4F\x4F\x4F\x4F\x4F\x4F",
+"\x36\x49\x36\x36\x36\x49\x36\x36\x36\x36\x36\x36\x36\x49\x36\x36\x36\x36\x36\x49\x36\x49\x36\x36\x36\x36\x49\x7C\x21\x5E\x21\x21\x21\x21\x5E\x21\x49\x49\x36\x5E\x21\x49\x49\x49\x49\x7C\x7C\x21\x7C\x36\x49\x36\x36\x36\x4F\x36\x36\x49\x7C\x7C\x7C\x7C\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x49\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x7C\x49\x49\x49\x49\x36\x49\x36\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F",
+"\x36\x36\x4F\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x36\x7C\x21\x21\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x7C\x49\x36\x36\x49\x4F\x36\x36\x36\x36\x36\x36\x36\x36\x49\x49\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x7C\x49\x7C\x49\x49\x49\x49\x36\x49\x36\x36\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F",
+"\x4F\x4F\x36\x4F\x36\x4F\x4F\x36\x4F\x36\x36\x4F\x36\x36\x36\x4F\x36\x36\x36\x4F\x36\x36\x36\x4F\x36\x36\x36\x49\x7C\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x49\x49\x49\x49\x49\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x49\x49\x49\x36\x49\x49\x36\x36\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F",
+"\x4F\x4F\x36\x4F\x4F\x4F\x4F\x4F\x36\x4F\x36\x4F\x36\x36\x4F\x4F\x36\x4F\x36\x4F\x36\x4F\x36\x36\x4F\x36\x4F\x49\x49\x7C\x21\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x49\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x49\x7C\x49\x7C\x49\x49\x49\x49\x36\x49\x36\x49\x36\x36\x4F\x4F\x4F\x4F\x4F\x36\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F",
+"\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x36\x36\x4F\x4F\x4F\x4F\x36\x36\x4F\x4F\x36\x4F\x36\x4F\x36\x4F\x4F\x4F\x36\x7C\x21\x21\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x7C\x49\x7C\x49\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x7C\x49\x7C\x49\x49\x49\x49\x36\x49\x36\x36\x36\x4F\x36\x4F\x4F\x36\x4F\x36\x4F\x36\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x36",
+"\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x36\x49\x7C\x21\x5E\x21\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x7C\x7C\x49\x49\x7C\x49\x49\x49\x49\x49\x49\x36\x36\x4F\x36\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x36\x4F\x4F\x4F",
+"\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x36\x36\x7C\x7C\x21\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x49\x49\x49\x49\x49\x49\x36\x36\x4F\x4F\x36\x4F\x36\x4F\x36\x4F\x4F\x36\x4F\x36\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x36\x4F\x36\x4F\x36\x4F",
+"\x4F\x4F\x4F\x4F\x4F\x51\x4F\x4F\x4F\x4F\x51\x4F\x51\x4F\x4F\x51\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x51\x4F\x4F\x4F\x51\x4F\x36\x7C\x7C\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x7C\x49\x49\x49\x36\x49\x36\x36\x36\x4F\x4F\x36\x36\x4F\x4F\x36\x4F\x36\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x4F\x36\x4F\x36\x36\x4F\x36\x36\x4F\x4F",
+"\x4F\x51\x4F\x51\x4F\x4F\x51\x4F\x51\x51\x4F\x51\x4F\x51\x4F\x4F\x4F\x4F\x51\x4F\x4F\x51\x4F\x51\x4F\x51\x4F\x4F\x51\x4F\x51\x4F\x36\x49\x7C\x21\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x7C\x49\x49\x49\x49\x36\x49\x49\x36\x49\x36\x36\x36\x36\x36\x36\x36\x4F\x36\x4F\x36\x4F\x36\x4F\x36\x4F\x36\x4F\x4F\x36\x36\x36\x36\x36\x36\x36\x36\x36",
+"\x4F\x51\x4F\x51\x4F\x4F\x51\x4F\x51\x51\x4F\x4F\x51\x51\x4F\x4F\x51\x51\x4F\x51\x4F\x51\x4F\x4F\x4F\x51\x51\x4F\x4F\x51\x51\x4F\x4F\x36\x7C\x21\x21\x5E\x5E\x5E\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x49\x49\x49\x49\x49\x49\x49\x36\x36\x49\x36\x49\x36\x49\x36\x36\x36\x36\x36\x36\x4F\x36\x4F\x36\x4F\x4F\x36\x36\x36\x36\x36\x49\x36\x49\x36\x49\x49\x36\x36",
+"\x51\x4F\x51\x4F\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x51\x4F\x51\x4F\x51\x4F\x51\x51\x4F\x4F\x36\x49\x7C\x21\x21\x5E\x5E\x5E\x21\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x7C\x49\x7C\x49\x49\x49\x49\x7C\x21\x5E\x5E\x5E\x5E\x21\x21\x7C\x49\x49\x36\x49\x36\x49\x36\x49\x49\x36\x49\x36\x36\x36\x36\x36\x36\x4F\x36\x36\x36\x36\x49\x36\x49\x49\x49\x49\x49\x49\x36",
+"\x51\x51\x4F\x51\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x51\x4F\x51\x4F\x51\x4F\x51\x4F\x51\x51\x51\x51\x51\x51\x4F\x4F\x36\x7C\x7C\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x7C\x7C\x7C\x49\x7C\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x49\x49\x49\x49\x49\x49\x49\x49\x21\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x21\x7C\x49\x49\x49\x49\x49\x49\x49\x49\x49\x49\x36\x36\x49\x36\x36\x36\x36\x36\x36\x49\x36\x49\x49\x49\x49\x49\x7C\x49\x49\x49",
+"\x51\x51\x4F\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x51\x4F\x51\x51\x51\x51\x51\x51\x51\x51\x51\x4F\x51\x4F\x51\x36\x49\x7C\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x7C\x49\x49\x49\x49\x7C\x7C\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x21\x7C\x36\x36\x36\x36\x36\x49\x49\x49\x20\x77\x77\x77\x2E\x73\x65\x67\x6E\x61\x6C\x69\x64\x69\x76\x69\x74\x61\x2E\x63\x6F\x6D"
+};
+
+char *img4[L4] = {
+    "\x4F\x5E\x21\x49\x51\x4F\x49\x49\x7C\x36\x5E\x21\x7C\x5E\x7C\x49\x5E\x2E\x2E\x5E\x2E\x2E\x36\x4D\x4D\x51\x4D\x4D\x4D\x4F\x51\x51\x4D\x4D\x49\x51\x36\x4D\x51\x51\x51\x51\x36\x7C\x36\x49\x49\x36\x51\x4F\x4F\x36\x49\x7C\x7C\x7C\x21\x7C\x21\x21\x21\x5E\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x7C\x21\x21\x7C\x7C\x7C\x7C\x49\x49\x5E\x21\x36\x36\x36\x49\x5E\x5E\x5E\x20\x2E\x5E\x51\x36\x7C\x2E\x2E\x20\x20\x2E\x20\x20\x2E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x7C\x36\x49\x36\x36\x4F\x21\x5E\x2E\x49\x36\x5E\x7C\x49\x4F\x7C\x2E\x5E\x2E\x5E\x4F\x4D\x4D\x4D\x4D\x4F\x36\x4F\x4D\x4D\x51\x49\x36\x51\x51\x51\x4F\x4D\x51\x4F\x4F\x36\x49\x49\x49\x36\x4F\x4F\x36\x36\x7C\x7C\x21\x7C\x21\x21\x21\x21\x5E\x21\x21\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x21\x21\x49\x36\x36\x36\x49\x5E\x20\x2E\x2E\x21\x51\x49\x7C\x2E\x20\x2E\x20\x2E\x20\x20\x20\x2E\x2E\x2E\x2E\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x49\x49\x7C\x7C\x49\x4F\x5E\x21\x7C\x21\x49\x7C\x51\x51\x49\x5E\x5E\x20\x21\x51\x4F\x4D\x51\x36\x49\x51\x36\x4F\x49\x7C\x51\x51\x51\x4F\x4D\x51\x51\x4D\x51\x49\x49\x7C\x49\x36\x4F\x51\x4F\x36\x36\x7C\x36\x7C\x21\x21\x21\x21\x5E\x21\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x21\x21\x21\x7C\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x49\x7C\x7C\x4F\x49\x36\x36\x21\x5E\x2E\x5E\x49\x51\x36\x21\x2E\x2E\x20\x20\x20\x20\x20\x20\x2E\x5E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x21\x7C\x49\x4F\x7C\x2E\x7C\x21\x49\x49\x2E\x49\x4F\x36\x5E\x5E\x5E\x7C\x7C\x4F\x36\x7C\x49\x36\x49\x7C\x21\x4D\x51\x36\x36\x51\x4D\x51\x4D\x51\x51\x4F\x49\x36\x36\x7C\x49\x4F\x4F\x4F\x4F\x49\x49\x7C\x7C\x21\x21\x5E\x21\x5E\x21\x21\x5E\x21\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x7C\x7C\x7C\x7C\x7C\x7C\x49\x49\x49\x36\x5E\x7C\x49\x36\x36\x49\x21\x5E\x2E\x21\x36\x49\x36\x2E\x2E\x2E\x20\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x7C\x49\x49\x5E\x21\x21\x4F\x51\x4F\x5E\x4D\x7C\x5E\x5E\x49\x20\x7C\x36\x7C\x7C\x21\x21\x49\x5E\x4D\x7C\x36\x49\x51\x51\x4F\x36\x51\x51\x4F\x36\x51\x4F\x36\x36\x49\x49\x51\x36\x4F\x4F\x36\x49\x7C\x21\x21\x21\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x7C\x7C\x21\x7C\x7C\x7C\x49\x49\x49\x7C\x49\x36\x49\x21\x49\x49\x36\x7C\x21\x2E\x2E\x21\x51\x4F\x49\x2E\x20\x2E\x20\x2E\x20\x20\x20\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x7C\x21\x5E\x21\x7C\x36\x4F\x21\x21\x36\x49\x5E\x21\x21\x2E\x7C\x21\x21\x21\x7C\x5E\x7C\x21\x36\x36\x4F\x4D\x51\x51\x51\x51\x49\x7C\x51\x4F\x49\x36\x51\x51\x4F\x4F\x4F\x51\x4F\x36\x36\x49\x7C\x21\x21\x21\x21\x21\x5E\x21\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x7C\x7C\x21\x7C\x7C\x49\x7C\x49\x49\x49\x36\x49\x36\x36\x36\x36\x7C\x5E\x2E\x5E\x7C\x4F\x7C\x5E\x2E\x2E\x20\x20\x2E\x2E\x20\x20\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x5E\x7C\x21\x36\x4F\x21\x4D\x51\x5E\x7C\x7C\x49\x5E\x5E\x21\x21\x7C\x21\x5E\x4D\x49\x51\x51\x4D\x4D\x4D\x4F\x36\x4F\x36\x7C\x7C\x4D\x4D\x4D\x51\x51\x4F\x4F\x4F\x51\x51\x36\x4F\x49\x49\x21\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x7C\x7C\x7C\x21\x21\x7C\x7C\x7C\x21\x21\x5E\x21\x21\x21\x5E\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x7C\x7C\x7C\x7C\x49\x7C\x49\x49\x36\x36\x36\x49\x36\x49\x5E\x5E\x2E\x5E\x36\x36\x7C\x2E\x5E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x21\x49\x36\x21\x4D\x49\x36\x7C\x21\x21\x4F\x51\x5E\x5E\x21\x5E\x51\x7C\x4D\x51\x4F\x36\x7C\x49\x49\x36\x4F\x51\x4D\x51\x4D\x51\x51\x51\x4F\x49\x4F\x51\x51\x36\x4F\x36\x36\x49\x7C\x21\x21\x21\x5E\x5E\x21\x21\x5E\x5E\x21\x21\x21\x5E\x21\x21\x21\x7C\x36\x36\x4F\x4F\x51\x51\x4D\x51\x51\x51\x51\x51\x4F\x49\x7C\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x7C\x21\x7C\x21\x7C\x7C\x7C\x7C\x49\x7C\x49\x36\x49\x49\x49\x49\x49\x7C\x5E\x5E\x2E\x21\x49\x21\x21\x5E\x20\x2E\x2E\x2E\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x36\x7C\x36\x4F\x4F\x7C\x51\x49\x7C\x4F\x49\x5E\x7C\x21\x49\x7C\x51\x49\x36\x36\x36\x36\x4D\x4D\x4D\x4D\x4D\x51\x4F\x4F\x51\x51\x4D\x4D\x4F\x36\x4F\x36\x36\x49\x7C\x21\x21\x21\x5E\x21\x21\x21\x21\x5E\x21\x5E\x21\x5E\x21\x21\x7C\x36\x4F\x4F\x51\x51\x51\x51\x51\x51\x51\x51\x4D\x51\x4D\x4D\x4D\x51\x4D\x51\x51\x51\x36\x7C\x7C\x21\x21\x7C\x21\x21\x21\x21\x7C\x7C\x21\x7C\x21\x7C\x7C\x7C\x49\x7C\x49\x7C\x49\x49\x49\x49\x7C\x2E\x2E\x5E\x7C\x7C\x5E\x5E\x5E\x20\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x21\x4D\x51\x21\x36\x4F\x49\x7C\x49\x2E\x5E\x5E\x7C\x49\x4F\x7C\x4F\x36\x4F\x4D\x4D\x4D\x51\x4D\x51\x4F\x36\x49\x4F\x51\x4D\x51\x4F\x4F\x36\x36\x7C\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x21\x21\x21\x7C\x36\x36\x4F\x4F\x36\x36\x49\x49\x49\x21\x7C\x7C\x7C\x7C\x49\x36\x4F\x51\x51\x51\x51\x51\x51\x51\x51\x4D\x51\x7C\x7C\x21\x7C\x7C\x21\x21\x21\x21\x21\x7C\x21\x7C\x21\x7C\x49\x7C\x7C\x7C\x7C\x49\x7C\x49\x7C\x5E\x2E\x2E\x21\x21\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x4D\x7C\x21\x4F\x4F\x7C\x5E\x21\x21\x5E\x7C\x49\x21\x49\x36\x4D\x4D\x4D\x4D\x4D\x51\x49\x36\x51\x4D\x4D\x4D\x51\x4F\x51\x4F\x4F\x4F\x49\x21\x21\x21\x5E\x5E\x21\x21\x5E\x21\x5E\x5E\x21\x5E\x5E\x5E\x21\x21\x7C\x7C\x7C\x7C\x21\x21\x21\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x21\x21\x21\x7C\x49\x7C\x7C\x49\x36\x51\x4F\x51\x51\x51\x4D\x51\x36\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x7C\x7C\x7C\x21\x7C\x7C\x21\x7C\x7C\x7C\x49\x7C\x21\x5E\x2E\x21\x5E\x21\x5E\x2E\x2E\x5E\x21\x5E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x7C\x7C\x36\x21\x21\x2E\x2E\x7C\x5E\x5E\x7C\x49\x36\x4D\x4D\x4D\x4D\x4D\x36\x4D\x4D\x51\x4D\x4D\x51\x4F\x4F\x4F\x36\x36\x4F\x36\x49\x49\x7C\x21\x21\x5E\x5E\x21\x21\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x7C\x7C\x7C\x7C\x7C\x49\x49\x49\x49\x49\x36\x36\x4F\x4F\x36\x49\x49\x7C\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x21\x7C\x7C\x7C\x7C\x21\x7C\x21\x21\x21\x21\x2E\x21\x5E\x5E\x5E\x2E\x5E\x5E\x21\x5E\x5E\x2E\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x21\x7C\x49\x5E\x21\x2E\x7C\x5E\x21\x49\x4F\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4F\x51\x51\x4D\x4F\x7C\x7C\x36\x7C\x49\x4F\x4F\x7C\x7C\x21\x5E\x21\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x21\x21\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x7C\x7C\x49\x36\x49\x4F\x36\x36\x36\x4F\x51\x36\x4F\x4F\x36\x49\x7C\x7C\x49\x7C\x7C\x7C\x5E\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x7C\x7C\x21\x7C\x21\x7C\x7C\x21\x21\x21\x21\x21\x7C\x5E\x2E\x21\x2E\x2E\x2E\x5E\x5E\x21\x5E\x5E\x2E\x5E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20",
+    "\x51\x36\x49\x5E\x21\x5E\x2E\x5E\x36\x36\x4D\x4D\x4D\x4D\x51\x51\x4D\x36\x51\x36\x36\x51\x4D\x4D\x4D\x4F\x51\x4F\x4F\x36\x49\x4F\x36\x7C\x7C\x21\x5E\x5E\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x7C\x36\x51\x4F\x4F\x51\x4D\x51\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x51\x36\x49\x49\x7C\x7C\x7C\x21\x5E\x21\x21\x21\x21\x7C\x21\x21\x21\x21\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x21\x5E\x5E\x21\x7C\x5E\x2E\x5E\x5E\x2E\x2E\x2E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20",
+    "\x51\x7C\x5E\x5E\x5E\x2E\x5E\x49\x36\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x4D\x51\x51\x4D\x51\x4F\x4F\x4F\x4F\x4F\x4F\x36\x49\x7C\x7C\x5E\x5E\x21\x5E\x5E\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x7C\x21\x7C\x49\x4F\x4D\x51\x51\x4D\x4D\x4D\x4F\x4F\x49\x7C\x49\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x51\x4F\x49\x49\x7C\x21\x21\x21\x5E\x21\x5E\x5E\x21\x7C\x21\x21\x21\x21\x7C\x49\x36\x4F\x51\x51\x4F\x36\x7C\x2E\x5E\x21\x2E\x2E\x5E\x20\x2E\x20\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x2E\x5E\x5E\x2E\x5E\x36\x51\x51\x51\x36\x49\x49\x49\x36\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x51\x51\x36\x4F\x36\x49\x49\x7C\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x7C\x7C\x49\x7C\x49\x49\x4F\x4F\x51\x36\x36\x36\x4F\x51\x51\x4D\x51\x7C\x21\x49\x4F\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4F\x36\x7C\x7C\x21\x21\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x5E\x21\x49\x49\x36\x51\x4F\x4D\x51\x51\x4D\x4F\x7C\x5E\x5E\x2E\x2E\x5E\x20\x2E\x20\x2E\x2E\x2E\x5E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x5E\x2E\x2E\x5E\x49\x4D\x51\x4F\x49\x7C\x49\x4D\x21\x7C\x7C\x49\x4D\x4D\x4D\x4F\x4F\x51\x51\x51\x4F\x36\x4F\x36\x36\x49\x49\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x21\x21\x7C\x21\x21\x7C\x21\x21\x21\x21\x7C\x21\x21\x21\x7C\x7C\x36\x51\x51\x51\x4D\x4D\x51\x51\x4D\x51\x4D\x4D\x4D\x4D\x4F\x51\x36\x49\x7C\x7C\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x2E\x21\x49\x49\x36\x36\x36\x4F\x51\x51\x51\x4D\x4D\x4F\x7C\x5E\x5E\x2E\x2E\x20\x20\x2E\x20\x2E\x2E\x2E\x2E\x20\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x5E\x2E\x2E\x7C\x4F\x51\x49\x7C\x7C\x4F\x4F\x7C\x7C\x49\x21\x21\x7C\x51\x4D\x51\x51\x51\x51\x51\x51\x4F\x4F\x49\x7C\x7C\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x21\x21\x21\x7C\x21\x21\x7C\x36\x36\x4F\x51\x51\x4D\x4D\x4D\x51\x4D\x51\x51\x4F\x4F\x49\x7C\x49\x7C\x21\x5E\x21\x21\x21\x21\x5E\x5E\x36\x4F\x4F\x51\x4F\x51\x4F\x36\x36\x4F\x51\x4D\x4F\x36\x21\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x5E\x2E\x21\x4F\x51\x49\x4D\x4D\x4F\x49\x7C\x21\x49\x4F\x7C\x5E\x21\x21\x7C\x4F\x4F\x36\x36\x36\x36\x49\x49\x49\x7C\x21\x7C\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x21\x5E\x5E\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x49\x49\x7C\x7C\x7C\x7C\x49\x36\x4F\x4F\x4F\x4F\x4D\x36\x51\x4F\x4F\x36\x49\x49\x7C\x7C\x21\x21\x21\x21\x21\x21\x21\x2E\x51\x51\x51\x51\x51\x4F\x4F\x4F\x36\x36\x36\x49\x5E\x7C\x21\x20\x2E\x20\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x5E\x5E\x4F\x49\x49\x51\x4D\x4F\x49\x7C\x7C\x7C\x49\x36\x21\x5E\x21\x21\x5E\x21\x7C\x49\x49\x49\x7C\x5E\x7C\x21\x21\x7C\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x7C\x7C\x7C\x49\x49\x36\x49\x36\x49\x36\x36\x36\x4F\x36\x36\x49\x49\x7C\x7C\x7C\x49\x49\x49\x7C\x7C\x7C\x21\x7C\x21\x21\x21\x21\x5E\x5E\x2E\x4D\x4D\x4D\x4D\x51\x51\x4F\x4F\x36\x49\x21\x2E\x21\x5E\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x5E\x21\x49\x7C\x49\x4D\x4F\x49\x7C\x21\x21\x7C\x5E\x21\x36\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x5E\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x21\x5E\x21\x21\x5E\x5E\x21\x5E\x21\x21\x21\x21\x7C\x21\x21\x7C\x7C\x7C\x7C\x7C\x7C\x7C\x49\x7C\x7C\x7C\x49\x49\x7C\x49\x49\x7C\x7C\x7C\x7C\x7C\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x5E\x2E\x36\x4D\x51\x4D\x4D\x51\x4D\x51\x51\x4F\x49\x5E\x2E\x2E\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x5E\x51\x7C\x21\x4F\x51\x36\x21\x21\x7C\x7C\x7C\x4F\x4D\x51\x21\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x21\x21\x21\x21\x7C\x7C\x21\x21\x7C\x21\x7C\x7C\x21\x21\x7C\x21\x7C\x7C\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x21\x5E\x5E\x20\x2E\x7C\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x21\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x5E\x36\x21\x7C\x51\x36\x21\x7C\x7C\x7C\x49\x36\x4F\x36\x36\x21\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x5E\x5E\x21\x5E\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x5E\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x21\x5E\x2E\x20\x2E\x7C\x21\x49\x36\x4D\x4D\x4D\x4D\x4D\x4D\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x21\x7C\x21\x7C\x4F\x49\x7C\x49\x49\x7C\x49\x4F\x4F\x49\x49\x7C\x21\x5E\x21\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x5E\x5E\x21\x5E\x5E\x21\x5E\x21\x21\x5E\x21\x5E\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x2E\x20\x20\x51\x51\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x21\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x7C\x49\x21\x7C\x4F\x36\x36\x49\x4F\x49\x36\x36\x7C\x7C\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x5E\x21\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x20\x7C\x4F\x36\x36\x51\x36\x4D\x4D\x4D\x21\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x21\x49\x5E\x7C\x36\x4F\x36\x36\x36\x49\x49\x7C\x21\x7C\x21\x21\x2E\x5E\x5E\x5E\x2E\x5E\x21\x21\x21\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x21\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x20\x20\x7C\x36\x36\x49\x7C\x5E\x49\x7C\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x21\x36\x5E\x21\x7C\x36\x36\x36\x36\x49\x7C\x7C\x21\x7C\x7C\x7C\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x21\x21\x21\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x20\x20\x20\x49\x4F\x36\x49\x5E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x5E\x49\x7C\x5E\x5E\x7C\x36\x4F\x36\x36\x49\x7C\x7C\x7C\x7C\x49\x7C\x2E\x5E\x5E\x5E\x5E\x21\x21\x2E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x21\x5E\x21\x21\x21\x5E\x21\x5E\x21\x21\x7C\x7C\x7C\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x2E\x20\x20\x2E\x36\x4F\x36\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x5E\x21\x4F\x7C\x5E\x21\x49\x36\x36\x7C\x5E\x5E\x21\x49\x49\x36\x49\x5E\x5E\x5E\x2E\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x49\x7C\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x20\x20\x2E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x2E\x7C\x49\x4F\x4D\x5E\x5E\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x21\x21\x21\x5E\x5E\x5E\x21\x5E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x7C\x49\x49\x21\x7C\x21\x5E\x21\x5E\x5E\x5E\x21\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x5E\x2E\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x2E\x5E\x7C\x4F\x51\x4D\x21\x5E\x5E\x21\x21\x5E\x21\x21\x21\x7C\x7C\x21\x21\x5E\x5E\x21\x5E\x2E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x21\x21\x21\x7C\x21\x21\x21\x7C\x7C\x7C\x49\x7C\x21\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x7C\x36\x36\x4F\x4F\x4F\x36\x49\x7C\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x21\x21\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x5E\x5E\x5E\x7C\x51\x4D\x4F\x4F\x2E\x5E\x21\x21\x5E\x21\x21\x7C\x7C\x7C\x7C\x5E\x5E\x21\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x7C\x7C\x7C\x49\x49\x7C\x7C\x7C\x21\x21\x21\x5E\x21\x21\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x21\x21\x21\x21\x7C\x49\x36\x4F\x49\x21\x5E\x21\x21\x21\x21\x5E\x20\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x2E\x21\x21\x4F\x49\x36\x36\x51\x51\x21\x5E\x5E\x5E\x21\x21\x21\x7C\x21\x21\x5E\x5E\x21\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x21\x21\x21\x21\x21\x7C\x7C\x49\x49\x49\x7C\x7C\x7C\x21\x21\x21\x21\x21\x5E\x21\x21\x21\x21\x7C\x21\x7C\x21\x21\x21\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x5E\x5E\x21\x5E\x5E\x2E\x2E\x7C\x21\x5E\x5E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x2E\x21\x21\x36\x36\x49\x36\x4F\x51\x7C\x36\x4F\x5E\x5E\x21\x21\x21\x21\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x21\x5E\x21\x21\x21\x21\x21\x21\x49\x36\x49\x49\x7C\x7C\x7C\x21\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x7C\x7C\x7C\x7C\x7C\x21\x7C\x7C\x7C\x7C\x5E\x5E\x5E\x5E\x2E\x49\x49\x36\x49\x7C\x21\x21\x5E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x5E\x49\x7C\x36\x51\x49\x7C\x7C\x36\x49\x7C\x51\x51\x4F\x49\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x7C\x49\x36\x49\x7C\x7C\x21\x7C\x21\x5E\x21\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x7C\x21\x7C\x49\x49\x49\x49\x49\x7C\x36\x7C\x5E\x5E\x2E\x7C\x36\x49\x36\x49\x49\x7C\x21\x5E\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x7C\x36\x7C\x36\x51\x4D\x4F\x7C\x21\x49\x21\x36\x51\x4F\x49\x7C\x21\x21\x21\x2E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x5E\x5E\x21\x21\x5E\x21\x49\x49\x7C\x7C\x7C\x7C\x7C\x21\x7C\x21\x21\x21\x21\x7C\x7C\x49\x49\x49\x49\x49\x49\x7C\x49\x7C\x7C\x7C\x21\x49\x7C\x7C\x7C\x7C\x7C\x5E\x2E\x20\x2E\x49\x49\x36\x36\x49\x49\x7C\x21\x21\x5E\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x7C\x51\x49\x49\x51\x4D\x4D\x4F\x49\x7C\x21\x7C\x36\x4F\x49\x21\x21\x21\x5E\x2E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x21\x5E\x5E\x21\x21\x36\x7C\x7C\x49\x36\x51\x4D\x4D\x51\x51\x4F\x4F\x4F\x36\x49\x49\x36\x36\x49\x49\x36\x36\x49\x4F\x36\x36\x36\x36\x49\x7C\x21\x5E\x2E\x2E\x20\x2E\x20\x7C\x36\x49\x36\x49\x49\x7C\x7C\x21\x21\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x7C\x36\x51\x49\x36\x4D\x4D\x51\x4F\x7C\x7C\x7C\x7C\x36\x49\x21\x21\x21\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x5E\x21\x21\x21\x7C\x49\x7C\x7C\x7C\x51\x51\x4D\x51\x4D\x49\x21\x49\x49\x21\x5E\x21\x7C\x49\x7C\x49\x36\x4F\x4F\x36\x49\x36\x36\x49\x36\x36\x36\x36\x4F\x49\x21\x2E\x20\x5E\x36\x36\x36\x49\x49\x7C\x7C\x21\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x7C\x7C\x36\x4F\x36\x51\x4D\x4D\x51\x49\x7C\x4F\x21\x21\x49\x7C\x21\x21\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x5E\x21\x5E\x21\x7C\x7C\x7C\x7C\x21\x7C\x49\x36\x4D\x49\x5E\x21\x49\x5E\x2E\x2E\x2E\x36\x5E\x2E\x2E\x21\x49\x5E\x2E\x5E\x7C\x51\x4F\x36\x36\x36\x36\x36\x36\x36\x49\x2E\x5E\x36\x36\x4F\x49\x49\x7C\x21\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x36\x21\x7C\x36\x4F\x51\x51\x4D\x4D\x4F\x49\x36\x49\x21\x21\x7C\x21\x21\x5E\x5E\x2E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x21\x5E\x21\x5E\x21\x21\x7C\x7C\x7C\x21\x21\x21\x21\x4F\x36\x7C\x21\x36\x5E\x2E\x5E\x2E\x7C\x2E\x2E\x2E\x5E\x7C\x2E\x2E\x2E\x2E\x49\x21\x5E\x5E\x4F\x51\x4D\x4F\x36\x7C\x2E\x21\x36\x51\x36\x49\x49\x21\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x7C\x49\x21\x49\x4F\x51\x4D\x4D\x4D\x51\x4F\x36\x36\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x7C\x21\x7C\x21\x21\x21\x5E\x21\x5E\x7C\x36\x51\x4D\x36\x2E\x5E\x21\x36\x2E\x20\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x7C\x5E\x2E\x2E\x4F\x49\x7C\x4D\x36\x49\x21\x49\x4F\x51\x36\x7C\x5E\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x21\x7C\x49\x5E\x36\x51\x4D\x4D\x4D\x4D\x4D\x51\x36\x7C\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x7C\x21\x21\x21\x21\x5E\x21\x5E\x5E\x21\x49\x36\x4F\x4F\x51\x4F\x4D\x51\x4F\x4D\x36\x5E\x5E\x2E\x2E\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x4D\x4D\x51\x4F\x36\x51\x4F\x36\x7C\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x21\x21\x4F\x7C\x7C\x49\x4D\x4D\x4D\x4D\x4D\x4D\x36\x49\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x5E\x21\x21\x21\x21\x5E\x21\x5E\x21\x21\x21\x5E\x5E\x5E\x5E\x21\x7C\x49\x36\x36\x4F\x4F\x4F\x4F\x51\x49\x49\x51\x51\x4D\x21\x2E\x21\x5E\x5E\x4F\x4D\x4D\x51\x36\x36\x51\x36\x7C\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x21\x7C\x36\x36\x49\x7C\x7C\x4F\x4D\x4D\x4D\x4D\x4F\x7C\x21\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x5E\x21\x21\x21\x5E\x21\x21\x5E\x21\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x21\x21\x7C\x36\x36\x36\x36\x4F\x4F\x49\x7C\x49\x36\x4F\x4D\x7C\x5E\x51\x4D\x4D\x4F\x36\x36\x51\x36\x49\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x21\x7C\x49\x7C\x49\x49\x36\x21\x36\x51\x4D\x4D\x36\x49\x21\x5E\x21\x21\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x5E\x21\x5E\x21\x5E\x21\x5E\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x5E\x21\x5E\x21\x21\x21\x7C\x49\x36\x36\x36\x36\x7C\x5E\x5E\x2E\x20\x2E\x21\x7C\x5E\x7C\x36\x4F\x36\x49\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x21\x7C\x49\x7C\x7C\x7C\x36\x4F\x7C\x4D\x4D\x51\x49\x7C\x21\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x21\x5E\x21\x5E\x5E\x5E\x21\x21\x21\x21\x5E\x21\x5E\x21\x21\x5E\x21\x21\x21\x7C\x7C\x7C\x7C\x49\x36\x36\x49\x49\x7C\x21\x2E\x20\x2E\x5E\x49\x51\x49\x49\x21\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x51\x21\x7C\x36\x36\x49\x7C\x7C\x4F\x51\x4D\x4D\x51\x49\x7C\x21\x5E\x21\x21\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x21\x5E\x21\x21\x21\x21\x21\x5E\x21\x5E\x21\x21\x21\x21\x7C\x21\x7C\x7C\x7C\x7C\x7C\x7C\x49\x36\x36\x49\x21\x2E\x20\x4F\x4F\x49\x7C\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x21\x7C\x49\x7C\x7C\x49\x36\x4D\x4D\x4D\x4D\x36\x21\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x21\x21\x21\x21\x21\x21\x7C\x21\x7C\x7C\x49\x7C\x7C\x49\x49\x7C\x21\x7C\x49\x21\x5E\x2E\x20\x51\x49\x21\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x4F\x21\x7C\x49\x21\x7C\x49\x36\x51\x51\x4D\x4D\x36\x21\x5E\x21\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x5E\x5E\x5E\x5E\x21\x21\x21\x21\x7C\x7C\x21\x7C\x7C\x7C\x7C\x7C\x49\x49\x49\x49\x7C\x7C\x21\x21\x2E\x2E\x20\x20\x49\x21\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+    "\x77\x77\x77\x2E\x73\x65\x67\x6E\x61\x6C\x69\x64\x69\x76\x69\x74\x61\x2E\x63\x6F\x6D\x20\x2E\x5E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x21\x21\x7C\x21\x21\x21\x7C\x21\x21\x7C\x21\x7C\x7C\x49\x7C\x7C\x21\x21\x5E\x5E\x20\x20\x2E\x21\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"
+};
+
+char *img5[L5] = {
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x4F\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x36\x7C\x5E\x5E\x2E\x5E\x21\x21\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x5E\x2E\x2E\x2E\x5E\x5E\x5E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x21\x49\x51\x51\x4D\x4D\x51\x4D\x4D\x4D\x51\x36\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x36\x7C\x21\x5E\x5E\x5E\x2E\x2E\x20\x2E\x20\x20\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x20\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x21\x4F\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x7C\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4F\x7C\x2E\x20\x20\x20\x2E\x2E\x20\x2E\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x21\x36\x51\x36\x51\x4D\x4D\x4D\x4D\x4D\x51\x21\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7C\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x21\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x20\x2E\x5E\x49\x4F\x4D\x51\x4F\x51\x4D\x4D\x4D\x4D\x4D\x2E\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x7C\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x2E\x2E\x20\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x21\x7C\x36\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x49\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x20\x2E\x20\x20\x2E\x21\x36\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x7C\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x21\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x7C\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x20\x2E\x2E\x5E\x7C\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x2E\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x5E\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x21\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x2E\x20\x20\x20\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x5E\x5E\x49\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x36\x51\x4D\x4D\x4D\x4D\x4D\x4D\x36\x49\x21\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x7C\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x5E\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x36\x49\x5E\x2E\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x5E\x7C\x4F\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x36\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x49\x7C\x2E\x2E\x2E\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x2E\x20\x2E\x2E\x2E\x21\x7C\x49\x51\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x7C\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x7C\x21\x5E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x2E\x5E\x5E\x21\x36\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x2E\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x49\x49\x21\x2E\x2E\x20\x20\x2E\x2E\x20\x20\x2E\x2E\x20\x2E\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x5E\x21\x21\x49\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x7C\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x51\x49\x7C\x21\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x5E\x21\x49\x4F\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4F\x5E\x2E\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x7C\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x49\x7C\x5E\x2E\x2E\x20\x20\x2E\x2E\x20\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x20\x2E\x2E\x2E\x5E\x5E\x21\x21\x36\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x20\x21\x2E\x20\x20",
+"\x20\x20\x20\x20\x20\x2E\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x49\x7C\x5E\x5E\x2E\x2E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x20\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x20\x2E\x20\x20\x2E\x2E\x20\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x21\x21\x7C\x36\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x2E\x2E\x20\x20",
+"\x20\x20\x20\x20\x20\x2E\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x49\x7C\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x5E\x5E\x5E\x21\x7C\x36\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x21\x20\x20",
+"\x20\x20\x20\x2E\x5E\x49\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4F\x49\x21\x21\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x20\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x20\x2E\x2E\x2E\x5E\x5E\x21\x5E\x5E\x5E\x2E\x2E\x5E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x5E\x2E\x2E\x7C\x7C\x4F\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x49\x21\x2E",
+"\x20\x20\x20\x20\x20\x2E\x21\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x49\x7C\x21\x5E\x5E\x5E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x21\x5E\x5E\x5E\x21\x21\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x21\x7C\x21\x21\x5E\x5E\x21\x7C\x36\x4F\x4F\x51\x4F\x4F\x51\x51\x51\x4D\x4D\x51\x51\x4F\x36\x49\x7C\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x5E\x2E\x2E\x5E\x7C\x7C\x4F\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x21\x2E\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x2E\x5E\x4F\x4D\x4D\x4D\x4D\x4D\x51\x49\x7C\x5E\x5E\x5E\x2E\x5E\x2E\x2E\x20\x2E\x2E\x5E\x7C\x49\x36\x49\x36\x4F\x36\x4F\x51\x51\x51\x51\x51\x4F\x4F\x49\x7C\x21\x5E\x5E\x2E\x2E\x2E\x2E\x20\x20\x2E\x2E\x20\x20\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x5E\x21\x7C\x7C\x49\x21\x7C\x49\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x36\x36\x4F\x4F\x51\x4F\x4F\x36\x21\x5E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x21\x7C\x49\x51\x4D\x4D\x4D\x4D\x51\x51\x36\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x51\x4D\x4D\x4D\x4D\x36\x49\x21\x5E\x5E\x5E\x2E\x5E\x21\x5E\x5E\x21\x7C\x36\x4F\x4F\x4F\x4F\x4F\x4F\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x36\x36\x7C\x5E\x5E\x2E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x21\x49\x49\x7C\x4F\x4F\x49\x4F\x4F\x4D\x51\x51\x51\x36\x49\x7C\x5E\x5E\x5E\x5E\x5E\x21\x7C\x7C\x49\x36\x49\x36\x49\x21\x2E\x2E\x5E\x5E\x2E\x2E\x2E\x5E\x21\x21\x21\x49\x51\x4D\x4D\x4D\x4D\x51\x51\x21\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x7C\x7C\x4D\x4D\x4D\x51\x4F\x49\x21\x5E\x5E\x2E\x5E\x2E\x5E\x5E\x7C\x36\x36\x36\x49\x21\x21\x7C\x21\x21\x21\x5E\x5E\x21\x49\x4F\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x49\x7C\x7C\x21\x5E\x5E\x5E\x5E\x5E\x2E\x21\x5E\x21\x49\x49\x36\x36\x4F\x4F\x4F\x4F\x36\x4F\x36\x36\x7C\x5E\x2E\x20\x2E\x2E\x2E\x20\x20\x2E\x20\x2E\x2E\x21\x21\x49\x49\x36\x7C\x5E\x2E\x5E\x2E\x2E\x5E\x5E\x5E\x21\x7C\x7C\x36\x51\x4D\x4D\x4D\x4D\x51\x49\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x4F\x4D\x4D\x4D\x51\x4F\x49\x21\x5E\x2E\x5E\x5E\x21\x2E\x5E\x49\x4F\x36\x49\x49\x7C\x7C\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x21\x49\x4F\x4F\x51\x51\x51\x51\x4D\x51\x51\x36\x36\x49\x7C\x21\x21\x7C\x21\x5E\x5E\x21\x49\x49\x36\x4F\x51\x4F\x4F\x4F\x4F\x36\x49\x7C\x7C\x49\x49\x49\x7C\x7C\x7C\x21\x21\x5E\x5E\x2E\x5E\x2E\x2E\x5E\x21\x21\x21\x21\x5E\x21\x21\x21\x21\x5E\x5E\x21\x21\x21\x21\x36\x51\x4D\x4D\x4D\x4D\x51\x21\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x49\x4D\x4D\x4D\x51\x4F\x49\x5E\x21\x5E\x2E\x5E\x5E\x2E\x7C\x36\x4F\x4F\x36\x7C\x21\x21\x7C\x7C\x21\x49\x49\x49\x4F\x51\x51\x51\x4D\x4D\x4D\x51\x4F\x4F\x4F\x51\x4F\x4F\x51\x4F\x4F\x36\x49\x7C\x21\x7C\x21\x21\x21\x21\x7C\x36\x4F\x51\x4F\x4F\x4F\x51\x36\x36\x51\x4D\x51\x7C\x49\x49\x36\x49\x36\x49\x36\x51\x51\x4D\x4F\x7C\x21\x5E\x2E\x2E\x2E\x5E\x21\x21\x7C\x5E\x5E\x7C\x21\x21\x21\x21\x7C\x36\x51\x4D\x4D\x4D\x4D\x51\x7C\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x49\x51\x51\x4D\x4D\x4F\x36\x21\x5E\x21\x5E\x2E\x7C\x5E\x21\x7C\x36\x4F\x49\x7C\x7C\x49\x36\x4D\x4D\x51\x51\x36\x4F\x36\x36\x49\x49\x49\x36\x4F\x51\x4D\x51\x4F\x51\x4F\x51\x4F\x51\x36\x49\x7C\x21\x5E\x5E\x5E\x5E\x5E\x49\x36\x4F\x51\x51\x51\x51\x4F\x4D\x51\x36\x4F\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x49\x7C\x7C\x21\x7C\x21\x21\x7C\x7C\x21\x2E\x5E\x21\x7C\x7C\x4F\x51\x4D\x4D\x51\x51\x51\x21\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x51\x4D\x4D\x4D\x51\x36\x21\x7C\x2E\x5E\x7C\x21\x5E\x2E\x5E\x49\x7C\x7C\x36\x51\x4D\x4D\x4D\x4D\x4D\x4F\x4F\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x4D\x51\x4D\x51\x4D\x51\x51\x4F\x49\x21\x5E\x5E\x2E\x2E\x2E\x2E\x7C\x36\x36\x4F\x51\x51\x51\x4D\x51\x51\x51\x21\x5E\x7C\x4D\x4D\x51\x4D\x4D\x4F\x21\x49\x4F\x36\x36\x4F\x4F\x36\x4F\x51\x4F\x36\x7C\x5E\x5E\x2E\x2E\x5E\x21\x5E\x21\x7C\x49\x4F\x51\x4D\x4D\x4D\x51\x4F\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x36\x4D\x4D\x4D\x4F\x36\x49\x7C\x21\x21\x21\x5E\x5E\x5E\x5E\x2E\x7C\x4F\x51\x4D\x4D\x4D\x51\x36\x49\x21\x21\x51\x4D\x4D\x4D\x4D\x4D\x21\x2E\x5E\x49\x4D\x4D\x4D\x4D\x4F\x51\x4F\x49\x7C\x5E\x2E\x2E\x2E\x20\x20\x20\x5E\x21\x7C\x21\x21\x7C\x7C\x21\x7C\x7C\x7C\x7C\x49\x21\x5E\x5E\x5E\x21\x21\x21\x7C\x21\x2E\x20\x2E\x2E\x20\x2E\x5E\x2E\x2E\x20\x2E\x20\x2E\x2E\x2E\x5E\x5E\x21\x7C\x49\x49\x4F\x51\x51\x51\x51\x51\x5E\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x36\x51\x51\x4D\x4F\x36\x7C\x7C\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x20\x20\x20\x2E\x5E\x5E\x2E\x7C\x7C\x7C\x7C\x21\x21\x5E\x5E\x21\x2E\x20\x5E\x5E\x2E\x5E\x21\x5E\x5E\x21\x49\x21\x21\x5E\x21\x5E\x2E\x2E\x20\x20\x20\x20\x2E\x2E\x5E\x5E\x2E\x2E\x5E\x7C\x21\x7C\x21\x21\x21\x5E\x2E\x2E\x20\x2E\x2E\x2E\x2E\x20\x2E\x20\x5E\x7C\x2E\x2E\x5E\x2E\x2E\x20\x2E\x2E\x2E\x5E\x5E\x5E\x21\x7C\x21\x49\x36\x4F\x4F\x4F\x51\x51\x49\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7C\x51\x4D\x51\x51\x4F\x49\x7C\x21\x21\x2E\x2E\x2E\x2E\x2E\x2E\x21\x5E\x2E\x21\x21\x21\x5E\x20\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x2E\x2E\x5E\x21\x21\x7C\x21\x5E\x2E\x20\x2E\x2E\x5E\x5E\x2E\x2E\x20\x20\x20\x20\x20\x2E\x2E\x5E\x5E\x2E\x20\x2E\x2E\x7C\x36\x4F\x49\x49\x7C\x7C\x7C\x21\x21\x21\x5E\x21\x49\x36\x49\x7C\x21\x21\x5E\x5E\x2E\x2E\x5E\x5E\x2E\x5E\x5E\x5E\x5E\x7C\x7C\x7C\x49\x36\x4F\x4F\x4F\x51\x36\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x36\x51\x51\x51\x4F\x36\x49\x7C\x21\x7C\x2E\x2E\x5E\x5E\x2E\x2E\x20\x2E\x20\x2E\x2E\x21\x49\x49\x21\x5E\x5E\x5E\x5E\x5E\x21\x7C\x36\x4F\x36\x21\x20\x20\x20\x20\x2E\x5E\x5E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x2E\x2E\x5E\x2E\x5E\x20\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x21\x49\x49\x36\x49\x7C\x5E\x2E\x20\x20\x2E\x2E\x2E\x20\x2E\x2E\x5E\x20\x20\x5E\x21\x5E\x5E\x7C\x7C\x21\x49\x49\x36\x36\x36\x4F\x4F\x4F\x5E\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x49\x4F\x51\x51\x4F\x4F\x36\x49\x49\x7C\x21\x7C\x5E\x2E\x2E\x2E\x2E\x2E\x20\x20\x2E\x20\x2E\x2E\x2E\x5E\x7C\x7C\x7C\x7C\x21\x5E\x2E\x20\x20\x2E\x20\x20\x20\x2E\x2E\x20\x2E\x2E\x2E\x5E\x2E\x2E\x20\x20\x20\x20\x20\x2E\x2E\x2E\x2E\x2E\x2E\x20\x20\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x2E\x2E\x21\x21\x21\x7C\x7C\x49\x49\x36\x4F\x51\x4F\x4F\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x36\x4F\x4F\x51\x4D\x51\x36\x36\x49\x7C\x7C\x21\x5E\x5E\x5E\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x20\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x2E\x5E\x21\x7C\x7C\x7C\x36\x36\x4F\x51\x4F\x4F\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x7C\x49\x4F\x51\x51\x51\x4F\x36\x49\x49\x21\x5E\x21\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x5E\x2E\x5E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x2E\x21\x7C\x7C\x7C\x36\x36\x36\x4F\x4F\x36\x5E\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x49\x36\x4F\x51\x4D\x51\x4F\x36\x49\x49\x21\x7C\x5E\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x2E\x2E\x2E\x5E\x7C\x7C\x21\x5E\x2E\x5E\x21\x5E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x5E\x20\x2E\x5E\x21\x21\x7C\x5E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x5E\x5E\x21\x49\x7C\x49\x49\x4F\x4F\x36\x4F\x2E\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x51\x36\x4F\x4D\x51\x51\x51\x4F\x49\x7C\x7C\x21\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x2E\x2E\x2E\x20\x2E\x5E\x21\x7C\x7C\x7C\x7C\x5E\x20\x2E\x20\x2E\x20\x5E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x20\x20\x20\x20\x2E\x21\x5E\x5E\x21\x21\x21\x5E\x5E\x5E\x2E\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x7C\x7C\x49\x4F\x4F\x4F\x4F\x36\x36\x21\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x36\x51\x51\x36\x51\x51\x51\x4F\x49\x7C\x7C\x21\x5E\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x21\x21\x7C\x49\x49\x7C\x7C\x21\x2E\x2E\x20\x2E\x20\x2E\x5E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x2E\x20\x20\x20\x20\x5E\x5E\x2E\x5E\x7C\x49\x7C\x21\x21\x5E\x2E\x2E\x2E\x2E\x20\x20\x2E\x2E\x20\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x5E\x21\x21\x49\x49\x4F\x4F\x4F\x51\x4F\x4F\x21\x2E\x2E\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x36\x36\x36\x36\x4F\x51\x4D\x4F\x4F\x49\x49\x7C\x7C\x5E\x5E\x5E\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x21\x21\x21\x7C\x36\x36\x36\x7C\x21\x5E\x5E\x5E\x21\x2E\x20\x2E\x20\x5E\x2E\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x20\x2E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x2E\x20\x2E\x2E\x2E\x5E\x49\x36\x36\x49\x21\x5E\x5E\x2E\x2E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x5E\x2E\x5E\x21\x21\x21\x7C\x49\x49\x4F\x51\x51\x51\x4F\x7C\x36\x21\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x2E\x21\x4D\x51\x51\x51\x51\x51\x49\x49\x49\x49\x49\x7C\x7C\x7C\x21\x21\x21\x21\x21\x21\x7C\x7C\x7C\x7C\x36\x4F\x36\x49\x21\x5E\x2E\x5E\x5E\x21\x7C\x4F\x4F\x36\x21\x5E\x21\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x20\x2E\x5E\x2E\x5E\x21\x5E\x49\x4F\x49\x21\x21\x2E\x5E\x2E\x2E\x5E\x5E\x36\x4F\x4F\x36\x49\x7C\x7C\x21\x21\x21\x21\x7C\x21\x21\x21\x5E\x21\x21\x21\x21\x21\x36\x36\x4F\x51\x51\x4D\x4F\x4F\x36\x7C\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x21\x21\x7C\x4F\x51\x51\x51\x51\x4D\x51\x36\x49\x49\x36\x36\x49\x36\x49\x49\x49\x7C\x7C\x7C\x7C\x49\x4F\x4F\x51\x36\x49\x7C\x21\x21\x21\x7C\x49\x49\x49\x4F\x51\x4D\x4D\x4D\x4D\x4F\x49\x49\x21\x5E\x21\x21\x5E\x5E\x21\x21\x7C\x7C\x36\x51\x4D\x4D\x4D\x49\x7C\x7C\x7C\x7C\x21\x5E\x2E\x21\x5E\x7C\x36\x4F\x51\x4F\x36\x49\x49\x7C\x7C\x7C\x7C\x7C\x7C\x21\x21\x7C\x21\x21\x7C\x49\x36\x51\x4F\x51\x4F\x36\x21\x7C\x2E\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x49\x4D\x51\x51\x4D\x4D\x51\x51\x4F\x36\x49\x36\x51\x4F\x36\x36\x49\x36\x4F\x4F\x4F\x4D\x51\x4F\x36\x49\x49\x49\x49\x36\x51\x51\x4F\x4F\x4F\x51\x4D\x51\x51\x4D\x4D\x4D\x4D\x51\x49\x49\x7C\x7C\x7C\x7C\x49\x36\x4F\x4D\x4D\x4D\x4D\x4D\x51\x51\x49\x49\x36\x36\x21\x21\x7C\x49\x21\x21\x7C\x36\x49\x36\x51\x51\x36\x7C\x49\x7C\x7C\x7C\x21\x21\x5E\x21\x7C\x7C\x49\x49\x36\x4F\x4F\x51\x49\x49\x21\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x7C\x4F\x51\x4D\x51\x4D\x4D\x4D\x4D\x4F\x36\x49\x36\x51\x4F\x49\x36\x4F\x4F\x4F\x4D\x4D\x36\x36\x51\x4F\x4F\x51\x51\x51\x51\x4D\x51\x51\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x51\x4F\x51\x4F\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x36\x4F\x36\x4F\x36\x36\x4F\x4F\x36\x4F\x49\x36\x36\x36\x4F\x51\x36\x49\x21\x21\x21\x21\x7C\x21\x21\x21\x7C\x36\x4F\x36\x4F\x51\x51\x4F\x36\x49\x2E\x5E\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x7C\x49\x51\x51\x4D\x51\x4D\x4D\x4D\x4F\x51\x4F\x36\x36\x36\x49\x49\x36\x36\x36\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x4F\x4F\x51\x51\x4D\x4D\x4D\x4D\x51\x4F\x4D\x4D\x51\x4D\x51\x36\x4F\x21\x5E\x7C\x21\x7C\x7C\x49\x7C\x36\x36\x36\x51\x51\x51\x51\x4F\x51\x7C\x21\x5E\x2E\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x5E\x4F\x36\x4D\x4D\x4F\x4D\x4D\x4D\x4D\x51\x51\x36\x4F\x36\x36\x49\x49\x4F\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x51\x4F\x51\x49\x21\x7C\x49\x49\x49\x4F\x36\x36\x51\x51\x51\x4D\x51\x4F\x36\x4F\x7C\x49\x7C\x2E\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x21\x5E\x36\x51\x51\x51\x4D\x4D\x4D\x4D\x4D\x51\x4F\x51\x4F\x49\x36\x49\x4F\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4F\x51\x51\x4F\x51\x4F\x4F\x36\x36\x49\x49\x49\x7C\x49\x7C\x36\x49\x36\x4F\x51\x51\x51\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x51\x4D\x4D\x4D\x51\x51\x4D\x51\x4D\x4D\x51\x51\x51\x51\x4F\x49\x49\x49\x49\x36\x4F\x51\x51\x51\x51\x51\x4D\x51\x36\x4F\x7C\x49\x5E\x49\x2E\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x49\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4F\x4F\x36\x4F\x4F\x4F\x51\x51\x4D\x4D\x4D\x4D\x4D\x51\x4F\x36\x36\x4F\x4D\x4D\x4D\x4D\x4D\x36\x7C\x36\x49\x49\x36\x4F\x4F\x36\x4F\x36\x36\x49\x49\x36\x49\x36\x4F\x51\x4F\x49\x4F\x49\x7C\x36\x7C\x4F\x4D\x4D\x4D\x51\x4F\x49\x49\x36\x49\x49\x36\x36\x4F\x4F\x36\x51\x51\x4F\x4F\x36\x36\x36\x4F\x36\x4F\x51\x51\x51\x51\x51\x49\x36\x7C\x49\x49\x21\x2E\x5E\x2E\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x36\x4F\x4D\x4D\x4F\x4D\x4D\x4D\x4D\x51\x4F\x4F\x4F\x51\x4F\x4F\x51\x51\x51\x51\x4D\x4D\x4F\x36\x7C\x21\x5E\x5E\x2E\x21\x36\x51\x4D\x51\x51\x7C\x21\x5E\x5E\x2E\x20\x21\x21\x2E\x2E\x5E\x7C\x7C\x20\x2E\x2E\x21\x2E\x2E\x21\x7C\x36\x4D\x51\x4D\x4F\x49\x7C\x5E\x20\x2E\x5E\x5E\x5E\x21\x7C\x7C\x49\x49\x36\x4F\x4F\x36\x4F\x51\x36\x36\x4F\x4F\x51\x51\x51\x51\x4D\x51\x36\x49\x49\x49\x49\x7C\x2E\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x7C\x49\x36\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x51\x51\x4F\x51\x51\x51\x51\x51\x51\x51\x4D\x4F\x7C\x21\x21\x5E\x2E\x2E\x2E\x2E\x20\x2E\x5E\x49\x4D\x4D\x4D\x51\x7C\x2E\x5E\x2E\x20\x20\x20\x20\x2E\x20\x20\x21\x4F\x4F\x51\x4D\x51\x4F\x36\x21\x5E\x2E\x2E\x20\x2E\x20\x2E\x2E\x2E\x5E\x5E\x7C\x36\x49\x7C\x7C\x36\x4F\x4F\x4F\x51\x4F\x4F\x4F\x4F\x51\x51\x4D\x4D\x4D\x4D\x51\x49\x7C\x7C\x36\x7C\x5E\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x5E\x21\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x51\x4F\x4D\x51\x51\x51\x4D\x51\x51\x4F\x49\x21\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x20\x5E\x2E\x2E\x2E\x5E\x7C\x21\x49\x36\x4F\x4F\x51\x51\x51\x51\x51\x4F\x4F\x49\x21\x7C\x7C\x21\x21\x5E\x20\x20\x2E\x20\x2E\x2E\x20\x20\x2E\x2E\x2E\x2E\x5E\x36\x49\x36\x49\x36\x4F\x36\x51\x4F\x51\x51\x4F\x51\x4F\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x49\x21\x5E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x49\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x4D\x51\x4F\x51\x4D\x51\x51\x36\x21\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x5E\x2E\x2E\x5E\x2E\x2E\x2E\x20\x20\x20\x20\x2E\x2E\x20\x2E\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x20\x2E\x2E\x5E\x5E\x7C\x7C\x36\x49\x36\x36\x51\x51\x51\x51\x51\x51\x4D\x51\x4D\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x36\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x21\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x51\x4D\x51\x4D\x4F\x4F\x49\x7C\x21\x5E\x5E\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x5E\x2E\x5E\x5E\x2E\x2E\x5E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x2E\x2E\x5E\x21\x49\x36\x4F\x36\x51\x4F\x4F\x51\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x5E\x20\x20\x20\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7C\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x51\x4F\x7C\x21\x21\x5E\x2E\x2E\x2E\x2E\x5E\x5E\x21\x5E\x5E\x2E\x2E\x5E\x5E\x5E\x5E\x5E\x5E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x5E\x2E\x2E\x5E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x2E\x2E\x5E\x2E\x5E\x2E\x5E\x5E\x21\x49\x4F\x4F\x51\x4F\x51\x51\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x36\x2E\x20\x20\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x49\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x4D\x51\x49\x21\x5E\x2E\x20\x2E\x2E\x2E\x5E\x5E\x21\x21\x21\x5E\x21\x21\x5E\x21\x5E\x21\x21\x7C\x21\x21\x21\x21\x21\x5E\x5E\x5E\x5E\x21\x5E\x21\x5E\x21\x21\x5E\x5E\x5E\x2E\x2E\x2E\x5E\x2E\x2E\x7C\x49\x51\x4F\x4F\x51\x51\x51\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x36\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x21\x20\x20",
+"\x20\x20\x20\x20\x20\x20\x2E\x36\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x21\x4F\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x36\x49\x7C\x21\x21\x5E\x2E\x2E\x2E\x5E\x7C\x7C\x7C\x49\x49\x36\x36\x51\x36\x4F\x36\x49\x49\x36\x49\x49\x36\x36\x36\x36\x49\x36\x49\x7C\x21\x21\x7C\x21\x5E\x5E\x20\x2E\x2E\x5E\x21\x7C\x36\x4F\x51\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4F\x36\x49\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x36",
+"\x20\x20\x20\x21\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x21\x2E\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x4F\x49\x7C\x21\x5E\x2E\x5E\x2E\x5E\x21\x7C\x7C\x36\x4F\x4F\x4F\x36\x51\x51\x51\x4F\x4F\x51\x4F\x4F\x4F\x36\x49\x36\x36\x49\x36\x7C\x7C\x21\x21\x5E\x2E\x2E\x2E\x5E\x5E\x21\x7C\x36\x51\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x49\x36\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x21\x5E\x5E\x49\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x51\x49\x7C\x21\x5E\x21\x5E\x21\x21\x21\x21\x49\x49\x36\x4F\x51\x4D\x51\x4F\x49\x36\x4F\x49\x36\x49\x7C\x7C\x36\x36\x36\x7C\x49\x7C\x5E\x2E\x2E\x2E\x5E\x5E\x5E\x7C\x7C\x36\x4D\x4D\x51\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x4F\x7C\x21\x49\x36\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x36\x2E\x20\x5E\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x36\x49\x49\x7C\x21\x5E\x21\x7C\x21\x7C\x49\x36\x4F\x4F\x36\x49\x49\x7C\x36\x36\x36\x49\x21\x5E\x21\x21\x5E\x49\x7C\x7C\x21\x2E\x5E\x21\x7C\x21\x21\x21\x7C\x4F\x4D\x4D\x51\x4D\x4D\x51\x4D\x4D\x51\x4D\x51\x4D\x4D\x4D\x4F\x21\x5E\x5E\x36\x7C\x21\x36\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x2E\x20\x5E\x21\x36\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x51\x4F\x36\x49\x49\x49\x21\x5E\x21\x7C\x7C\x49\x49\x49\x7C\x7C\x7C\x49\x7C\x7C\x49\x21\x21\x5E\x2E\x5E\x2E\x5E\x21\x5E\x21\x36\x21\x21\x21\x49\x49\x36\x51\x4D\x51\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x49\x5E\x5E\x2E\x2E\x21\x49\x36\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x2E\x2E\x2E\x20\x5E\x21\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x4F\x36\x7C\x49\x7C\x7C\x21\x7C\x21\x7C\x7C\x49\x7C\x49\x36\x7C\x49\x7C\x21\x5E\x21\x5E\x5E\x7C\x7C\x49\x21\x21\x49\x49\x36\x36\x36\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x49\x7C\x21\x21\x5E\x5E\x2E\x21\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x21\x20\x2E\x2E\x2E\x5E\x7C\x4F\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x4D\x51\x4F\x4F\x4F\x4F\x36\x36\x49\x36\x49\x49\x7C\x7C\x49\x49\x49\x36\x7C\x49\x21\x7C\x21\x5E\x7C\x7C\x49\x4F\x49\x49\x51\x4F\x51\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x21\x2E\x2E\x2E\x2E\x2E\x21\x5E\x5E\x36\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x51\x49\x2E\x20\x20\x2E\x5E\x21\x36\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4F\x36\x36\x49\x49\x49\x49\x36\x36\x49\x49\x49\x49\x49\x7C\x49\x49\x7C\x49\x4F\x36\x51\x4F\x4F\x36\x51\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x49\x5E\x5E\x2E\x20\x20\x2E\x5E\x21\x2E\x2E\x36\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x2E\x20\x20\x2E\x2E\x21\x7C\x49\x36\x49\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x51\x36\x4F\x36\x36\x4F\x4F\x4F\x36\x51\x4F\x36\x4F\x36\x36\x36\x36\x36\x51\x51\x51\x4D\x51\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4F\x21\x5E\x2E\x2E\x2E\x2E\x20\x2E\x20\x20\x2E\x2E\x5E\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x5E\x2E\x20\x20\x2E\x5E\x21\x7C\x49\x49\x4F\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x51\x4D\x51\x51\x51\x51\x4D\x51\x51\x4D\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x4D\x4D\x4D\x4D\x51\x49\x21\x21\x2E\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x20\x2E\x5E\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x36\x20\x2E\x2E\x20\x2E\x20\x2E\x5E\x21\x7C\x49\x51\x51\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x51\x51\x4D\x51\x36\x7C\x21\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x21\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x51\x2E\x20\x20\x2E\x20\x2E\x20\x2E\x2E\x2E\x5E\x21\x4F\x7C\x36\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x51\x51\x4D\x4F\x7C\x5E\x20\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x2E\x49\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x21\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x20\x2E\x5E\x5E\x21\x21\x7C\x36\x51\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4D\x4D\x51\x51\x4D\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x51\x51\x51\x36\x21\x5E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x20\x36\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x36\x2E\x2E\x2E\x20\x20\x20\x2E\x20\x20\x20\x2E\x2E\x2E\x5E\x21\x7C\x49\x49\x36\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4D\x4D\x51\x4D\x4D\x4D\x4F\x36\x7C\x5E\x2E\x2E\x20\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x2E\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x5E\x5E\x21\x7C\x49\x7C\x49\x4F\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4F\x7C\x5E\x5E\x2E\x2E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x20\x2E\x2E\x21\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x5E\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x21\x7C\x21\x7C\x49\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4F\x21\x5E\x2E\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x20\x36\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x5E\x21\x7C\x7C\x49\x4F\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x4D\x4F\x7C\x2E\x2E\x2E\x20\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x2E\x2E\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D",
+"\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x21\x7C\x49\x7C\x51\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x4D\x51\x7C\x2E\x2E\x20\x2E\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x77\x77\x2E\x73\x65\x67\x6E\x61\x6C\x69\x64\x69\x76\x69\x74\x61\x2E\x63\x6F\x6D"
+};
+
+/*
+ * alive 값이 true이면 각 스레드는 무한 루프를 돌며 반복해서 일을 하고,
+ * alive 값이 false가 되면 무한 루프를 빠져나와 스레드를 자연스럽게 종료한다.
+ */
+bool alive = true;
+
+// 모든 reader 와 writer 가 함께 쓰는 reader-writer 락, 정책은 실행 인자로 정함 (26.10.19)
+rwlock_t rwlock;
+
+// 참이면 writer가 쓰기 락을 직접 얻지 않고 rwlock_combine()으로 출력을 맡김 (26.10.19)
+bool combine = false;
+
+/*
+ * Reader 스레드는 같은 문자를 L0번 출력한다. 예를 들면 <AAA...AA> 이런 식이다.
+ * 출력할 문자는 인자를 통해 0이면 A, 1이면 B, ..., 등으로 출력하며, 시작과 끝을 <...>로 나타낸다.
+ * 단일 reader라면 <AAA...AA>처럼 같은 문자만 출력하겠지만, critical section에서 reader의
+ * 중복을 허용하기 때문에 reader가 많아지면 출력이 어지럽게 섞여서 나오는 것이 정상이다.
+ */
+void *reader(void *arg)
+{
+    int id, i;
+
+    /*
+     * 들어온 인자를 통해 출력할 문자의 종류를 정한다.
+     */
+    id = *(int *)arg;
+    /*
+     * 스레드가 살아 있는 동안 같은 문자열 시퀀스 <XXX...XX>를 반복해서 출력한다.
+     */
+    while (alive) {
+        rwlock_rdlock(&rwlock);
+        /*
+         * Begin Critical Section
+         */
+        printf("<");
+        for (i = 0; i < L0; ++i)
+            printf("%c", 'A'+id);
+        printf(">");
+        /* 
+         * End Critical Section
+         */
+        rwlock_rdunlock(&rwlock);
+    }
+    pthread_exit(NULL);
+}
+
+/*
+ * id번 얼굴 이미지를 출력한다. 쓰기 락 아래에서 불리며, combine이면 다른 writer가 대신 부를 수도 있다.
+ */
+void draw_face(void *arg)
+{
+    int id = *(int *)arg, i;
+
+    printf("\n");
+    switch (id) {
+        case 0:
+            for (i = 0; i < L1; ++i)
+                printf("%s\n", img1[i]);
+            break;
+        case 1:
+            for (i = 0; i < L2; ++i)
+                printf("%s\n", img2[i]);
+            break;
+        case 2:
+            for (i = 0; i < L3; ++i)
+                printf("%s\n", img3[i]);
+            break;
+        case 3:
+            for (i = 0; i < L4; ++i)
+                printf("%s\n", img4[i]);
+            break;
+        case 4:
+            for (i = 0; i < L5; ++i)
+                printf("%s\n", img5[i]);
+            break;
+        default:
+            ;
+    }
+}
+
+/*
+ * Writer 스레드는 어떤 사람의 얼굴 이미지를 출력한다.
+ * 이미지는 여러 종류가 있으며 인자를 통해 식별한다.
+ * Writer가 critical section에 있으면 다른 writer는 물론이고 어떠한 reader도 들어올 수 없다.
+ * 만일 이것을 어기고 다른 writer나 reader가 들어왔다면 얼굴 이미지가 깨져서 쉽게 감지된다.
+ */
+void *writer(void *arg)
+{
+    int id;
+    struct timespec req;
+
+    /*
+     * 들어온 인자를 통해 얼굴 이미지의 종류를 정한다.
+     * 랜덤 생성기의 시드 값을 현재 시간으로 초기화한다.
+     */
+    id = *(int *)arg;
+    srand(time(NULL));
+    /*
+     * 스레드가 살아 있는 동안 같은 이미지를 반복해서 출력한다.
+     */
+    while (alive) {
+        if (combine) {
+            rwlock_combine(&rwlock, draw_face, &id);
+        } else {
+            rwlock_wrlock(&rwlock);
+            /*
+             * Begin Critical Section
+             */
+            draw_face(&id);
+            /*
+             * End Critical Section
+             */
+            rwlock_wrunlock(&rwlock);
+        }
+        /*
+         * 이미지 출력 후 SLEEPTIME 나노초 안에서 랜덤하게 쉰다.
+         */
+        req.tv_sec = 0;
+        req.tv_nsec = rand() % SLEEPTIME;
+        nanosleep(&req, NULL);
+    }
+    pthread_exit(NULL);
+}
+
+/*
+ * 메인 함수는 실행 인자로 받은 정책(reader, writer, fair, bigreader, phasefair)으로 rwlock을 초기화한 뒤,
+ * NREAD 개의 reader 스레드를 생성하고, NWRITE 개의 writer 스레드를 생성한다.
+ * 생성된 스레드가 일을 할 동안 0.2초 동안 기다렸다가 alive의 값을 0으로 바꿔서 모든 스레드가
+ * 무한 루프를 빠져나올 수 있게 만든 후, 스레드가 자연스럽게 종료할 때까지 기다리고 메인을 종료한다.
+ */
+int main(int argc, char *argv[])
+{
+    int i, policy;
+    int rarg[NREAD], warg[NWRITE];
+    pthread_t rthid[NREAD];
+    pthread_t wthid[NWRITE];
+    struct timespec req;
+
+    /*
+     * Choose the rwlock policy
+     */
+    if (argc < 2 || strcmp(argv[1], "reader") == 0)
+        policy = RWLOCK_READER;
+    else if (strcmp(argv[1], "writer") == 0)
+        policy = RWLOCK_WRITER;
+    else if (strcmp(argv[1], "fair") == 0)
+        policy = RWLOCK_FAIR;
+    else if (strcmp(argv[1], "bigreader") == 0)
+        policy = RWLOCK_BIGREADER;
+    else if (strcmp(argv[1], "phasefair") == 0)
+        policy = RWLOCK_PHASEFAIR;
+    else {
+        fprintf(stderr, "usage: %s [reader|writer|fair|bigreader|phasefair] [combine]\n", argv[0]);
+        return -1;
+    }
+    if (argc > 2 && strcmp(argv[2], "combine") == 0)
+        combine = true;
+    if (rwlock_init(&rwlock, policy) != RWLOCK_SUCCESS) {
+        fprintf(stderr, "rwlock_init error\n");
+        return -1;
+    }
+    /*
+     * Create NREAD reader threads
+     */
+    for (i = 0; i < NREAD; ++i) {
+        rarg[i] = i;
+        if (pthread_create(rthid+i, NULL, reader, rarg+i) != 0) {
+            fprintf(stderr, "pthread_create error\n");
+            return -1;
+        }
+    }
+    /* 
+     * Create NWRITE writer threads
+     */
+    for (i = 0; i < NWRITE; ++i) {
+        warg[i] = i;
+        if (pthread_create(wthid+i, NULL, writer, warg+i) != 0) {
+            fprintf(stderr, "pthread_create error\n");
+            return -1;
+        }
+    }
+    /* 
+     * Wait for RUNTIME nanoseconds while the threads are working
+     */
+    req.tv_sec = 0;
+    req.tv_nsec = RUNTIME;
+    nanosleep(&req, NULL);
+    /*
+     * Now terminate all threads and leave
+     */
+    alive = false;
+    for (i = 0; i < NREAD; ++i)
+        pthread_join(rthid[i], NULL);
+    for (i = 0; i < NWRITE; ++i)
+        pthread_join(wthid[i], NULL);
+    rwlock_destroy(&rwlock);
+    
+    return 0;
+}
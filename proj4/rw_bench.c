@@ -0,0 +1,308 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by Kim Taehyeon (2019061658 컴퓨터학부 김태현) (26.10.19)
+
+/*
+ * rwlock의 정책들을 같은 부하에서 비교하는 벤치마크이다. 원래 프로그램처럼 이미지를 출력하는 대신
+ * 락 안에서 공유 배열을 -c 개의 원소만큼 읽거나 고치는 일을 하고, 락 밖에서는 쉬지 않고 다음 요청을 한다.
+ * reader 스레드는 요청 중 -m 퍼센트를 읽기로, 나머지를 쓰기로 하고 writer 스레드는 모두 쓰기로 한다.
+ * reader 수와 writer 수를 1부터 두 배씩 -r, -w까지, 읽기 비율을 -m에 준 값마다 바꿔 가며 정책마다 CSV 한 줄을 출력한다.
+ * 락을 요청해서 얻기까지 걸린 시간을 읽기와 쓰기로 나눠 재고, 각각의 p99와 가장 오래 기다린 쓰기(writer 기아)를 보인다.
+ * torn은 reader가 일관되지 않은 배열을 본 횟수로, 모든 정책에서 0이어야 한다.
+ * -f를 주면 쓰기를 rwlock_combine()으로 하고 정책 이름 뒤에 +fc를 붙인다. 이때 쓰기의 지연 시간은
+ * 요청해서 combiner가 일을 끝내 줄 때까지이므로 임계구역 시간이 들어간다.
+ * -x를 주면 쓰기마다 wrlock, trywrlock, timedwrlock 중 하나를 골라 쓰고 정책 이름 뒤에 +mix를 붙인다.
+ * 얻지 못한 try와 timed 쓰기는 세지 않고 다음 요청으로 넘어가며, reader는 가끔 락 안에서 양보해
+ * 기다리다 포기하는 writer와 들어오는 reader가 엇갈리게 한다. 끝나지 않으면 정책이 교착에 빠진 것이다.
+ *
+ * 사용법: rw_bench [-r reader수] [-w writer수] [-t 실행시간(ms)] [-c 임계구역_원소수] [-m 읽기비율,...] [-f] [-x]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include "rwlock.h"
+
+#define NREAD 8
+#define NWRITE 4
+#define RUNTIME 200
+#define CSWORK 64
+#define MAXWORK 4096
+#define MAXRATIO 8
+#define MIXWAIT 20000                       /* -x에서 timedwrlock에 주는 기한의 최댓값(ns) */
+
+/*
+ * 지연 시간 히스토그램은 2의 거듭제곱 구간마다 HIST_SUB 개로 나눈 로그 구간을 쓴다.
+ * 구간의 오차는 1/HIST_SUB 이하이고, 스레드마다 따로 세어 두었다가 끝에 합친다.
+ */
+#define HIST_SUB 8
+#define HIST_BITS 3
+#define HIST_NBUCKET (64 * HIST_SUB)
+
+enum { READ, WRITE, NCLASS };
+
+static const int policies[] = { RWLOCK_READER, RWLOCK_WRITER, RWLOCK_FAIR, RWLOCK_BIGREADER, RWLOCK_PHASEFAIR };
+static const char *policy_name[] = { "reader_prefer", "writer_prefer", "fair", "bigreader", "phasefair" };
+#define NPOLICY (int)(sizeof(policies) / sizeof(policies[0]))
+
+static atomic_bool alive;
+static rwlock_t rwlock;
+static uint64_t shared[MAXWORK];
+static int cswork = CSWORK;
+static bool combine;
+static bool mixed;
+
+typedef struct {
+    pthread_t tid;
+    unsigned seed;
+    int read_pct;                           /* 요청 중 읽기의 비율(%) */
+    unsigned long ops[NCLASS];
+    unsigned long torn;
+    uint64_t max_wait[NCLASS];
+    unsigned long hist[NCLASS][HIST_NBUCKET];
+} worker_t;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * 나노초 값이 들어갈 히스토그램 구간을 구한다. HIST_SUB보다 작은 값은 그대로 구간 번호가 된다.
+ */
+static int bucket_of(uint64_t ns)
+{
+    int msb;
+
+    if (ns < HIST_SUB)
+        return (int)ns;
+    msb = 63 - __builtin_clzll(ns);
+    return (msb - HIST_BITS + 1) * HIST_SUB + (int)((ns >> (msb - HIST_BITS)) & (HIST_SUB - 1));
+}
+
+/*
+ * 구간 번호에 속하는 가장 큰 나노초 값을 돌려준다.
+ */
+static uint64_t bucket_max(int b)
+{
+    int shift;
+
+    if (b < HIST_SUB)
+        return b;
+    shift = b / HIST_SUB - 1;
+    return (((uint64_t)(HIST_SUB + b % HIST_SUB) + 1) << shift) - 1;
+}
+
+/*
+ * 합친 히스토그램에서 p 퍼센트 위치의 값을 구한다. 측정이 없으면 0이다.
+ */
+static uint64_t percentile(const unsigned long *hist, unsigned long n, double p)
+{
+    unsigned long rank = (unsigned long)(n * p / 100.0), seen = 0;
+
+    if (n == 0)
+        return 0;
+    for (int b = 0; b < HIST_NBUCKET; b++) {
+        seen += hist[b];
+        if (seen > rank)
+            return bucket_max(b);
+    }
+    return bucket_max(HIST_NBUCKET - 1);
+}
+
+/*
+ * 락 안에서 하는 일이다. writer는 모든 원소를 같은 새 값으로 바꾸고, reader는 모두 같은지 확인한다.
+ */
+static void critical(worker_t *w, int class)
+{
+    uint64_t v;
+
+    if (class == WRITE) {
+        v = shared[0] + 1;
+        for (int i = 0; i < cswork; i++)
+            shared[i] = v;
+        return;
+    }
+    v = shared[0];
+    for (int i = 1; i < cswork; i++)
+        if (shared[i] != v) {
+            w->torn++;
+            break;
+        }
+}
+
+/*
+ * rwlock_combine()으로 올리는 쓰기이다. combiner가 대신 부르므로 worker를 인자로 받는다.
+ */
+static void write_op(void *arg)
+{
+    critical((worker_t *)arg, WRITE);
+}
+
+/*
+ * -x에서 쓰기 락을 얻는다. 세 가지 방법 중 하나를 골라 쓰고, 얻지 못하면 거짓을 돌려준다.
+ */
+static bool mixed_wrlock(worker_t *w)
+{
+    struct timespec abstime;
+
+    switch (rand_r(&w->seed) % 3) {
+        case 0:
+            return rwlock_wrlock(&rwlock) == RWLOCK_SUCCESS;
+        case 1:
+            return rwlock_trywrlock(&rwlock) == RWLOCK_SUCCESS;
+        default:
+            clock_gettime(CLOCK_REALTIME, &abstime);
+            abstime.tv_nsec += rand_r(&w->seed) % MIXWAIT;
+            if (abstime.tv_nsec >= 1000000000L) {
+                abstime.tv_sec++;
+                abstime.tv_nsec -= 1000000000L;
+            }
+            return rwlock_timedwrlock(&rwlock, &abstime) == RWLOCK_SUCCESS;
+    }
+}
+
+static void *worker(void *arg)
+{
+    worker_t *w = (worker_t *)arg;
+    uint64_t t0, wait;
+    int class;
+
+    while (alive) {
+        class = (int)(rand_r(&w->seed) % 100) < w->read_pct ? READ : WRITE;
+        t0 = now_ns();
+        if (class == WRITE && combine) {
+            rwlock_combine(&rwlock, write_op, w);
+            wait = now_ns() - t0;
+        } else if (class == READ) {
+            rwlock_rdlock(&rwlock);
+            wait = now_ns() - t0;
+            critical(w, READ);
+            if (mixed && rand_r(&w->seed) % 2)
+                sched_yield();
+            rwlock_rdunlock(&rwlock);
+        } else if (mixed) {
+            if (!mixed_wrlock(w))
+                continue;
+            wait = now_ns() - t0;
+            critical(w, WRITE);
+            rwlock_wrunlock(&rwlock);
+        } else {
+            rwlock_wrlock(&rwlock);
+            wait = now_ns() - t0;
+            critical(w, WRITE);
+            rwlock_wrunlock(&rwlock);
+        }
+        w->ops[class]++;
+        w->hist[class][bucket_of(wait)]++;
+        if (wait > w->max_wait[class])
+            w->max_wait[class] = wait;
+    }
+    return NULL;
+}
+
+/*
+ * policy 정책으로 nread개의 reader와 nwrite개의 writer를 runtime 밀리초 동안 돌리고 결과를 한 줄 출력한다.
+ */
+static void run(int p, int nread, int nwrite, int read_pct, int runtime)
+{
+    int n = nread + nwrite;
+    worker_t *w = (worker_t *)calloc(n, sizeof(worker_t));
+    static unsigned long hist[NCLASS][HIST_NBUCKET];
+    unsigned long ops[NCLASS] = { 0, 0 }, torn = 0;
+    uint64_t max_wait[NCLASS] = { 0, 0 };
+    struct timespec req;
+
+    if (w == NULL || rwlock_init(&rwlock, policies[p]) != RWLOCK_SUCCESS) {
+        fprintf(stderr, "%s: init failed\n", policy_name[p]);
+        exit(1);
+    }
+    memset(shared, 0, sizeof(shared));
+    memset(hist, 0, sizeof(hist));
+    alive = true;
+    for (int i = 0; i < n; i++) {
+        w[i].seed = (unsigned)i + 1;
+        w[i].read_pct = i < nread ? read_pct : 0;
+        pthread_create(&w[i].tid, NULL, worker, w + i);
+    }
+    req.tv_sec = runtime / 1000;
+    req.tv_nsec = (runtime % 1000) * 1000000L;
+    nanosleep(&req, NULL);
+    alive = false;
+    for (int i = 0; i < n; i++) {
+        pthread_join(w[i].tid, NULL);
+        torn += w[i].torn;
+        for (int c = 0; c < NCLASS; c++) {
+            ops[c] += w[i].ops[c];
+            if (w[i].max_wait[c] > max_wait[c])
+                max_wait[c] = w[i].max_wait[c];
+            for (int b = 0; b < HIST_NBUCKET; b++)
+                hist[c][b] += w[i].hist[c][b];
+        }
+    }
+    rwlock_destroy(&rwlock);
+    free(w);
+    printf("%s%s%s,%d,%d,%d,%d,%d,%lu,%lu,%.0f,%llu,%llu,%llu,%lu\n", policy_name[p], combine ? "+fc" : "", mixed ? "+mix" : "",
+           nread, nwrite, read_pct, cswork, runtime, ops[READ], ops[WRITE], (ops[READ] + ops[WRITE]) * 1000.0 / runtime,
+           (unsigned long long)percentile(hist[READ], ops[READ], 99),
+           (unsigned long long)percentile(hist[WRITE], ops[WRITE], 99),
+           (unsigned long long)max_wait[WRITE], torn);
+    fflush(stdout);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-r readers] [-w writers] [-t runtime_ms] [-c cs_work] [-m read_pct,...] [-f] [-x]\n", prog);
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    int nread = NREAD, nwrite = NWRITE, runtime = RUNTIME, opt;
+    int ratio[MAXRATIO] = { 100, 90 }, nratio = 2;
+    char *tok;
+
+    while ((opt = getopt(argc, argv, "r:w:t:c:m:fx")) != -1) {
+        switch (opt) {
+            case 'r': nread = atoi(optarg); break;
+            case 'w': nwrite = atoi(optarg); break;
+            case 't': runtime = atoi(optarg); break;
+            case 'c': cswork = atoi(optarg); break;
+            case 'm':
+                nratio = 0;
+                for (tok = strtok(optarg, ","); tok != NULL && nratio < MAXRATIO; tok = strtok(NULL, ","))
+                    ratio[nratio++] = atoi(tok);
+                break;
+            case 'f': combine = true; break;
+            case 'x': mixed = true; break;
+            default: usage(argv[0]);
+        }
+    }
+    if (nread < 1 || nwrite < 0 || runtime < 1 || cswork < 1 || cswork > MAXWORK || nratio == 0 || (combine && mixed))
+        usage(argv[0]);
+    for (int i = 0; i < nratio; i++)
+        if (ratio[i] < 0 || ratio[i] > 100)
+            usage(argv[0]);
+
+    printf("policy,readers,writers,read_pct,cs_work,runtime_ms,reads,writes,ops_per_sec,"
+           "read_p99_ns,write_p99_ns,max_write_wait_ns,torn\n");
+    for (int r = 1; r <= nread; r *= 2)
+        for (int wr = nwrite > 0 ? 1 : 0; wr <= nwrite; wr = wr ? wr * 2 : 1)
+            for (int m = 0; m < nratio; m++)
+                for (int p = 0; p < NPOLICY; p++)
+                    run(p, r, wr, ratio[m], runtime);
+    return 0;
+}
@@ -0,0 +1,1168 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by Kim Taehyeon (2019061658 컴퓨터학부 김태현) (26.10.19)
+#include <errno.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rwlock.h"
+
+#define RW_WRITER 1u
+#define RW_WAITING 2u
+#define RW_READER 4u
+
+// RWLOCK_PHASEFAIR의 rin 비트, reader 수는 PF_READER 단위로 센다 (26.10.19)
+// writer 표시는 PF_PRESENT와 PF_GEN 단위로 세는 7비트 세대로 이루어진다 (26.10.19)
+#define PF_PRESENT 1u
+#define PF_GEN 2u
+#define PF_WBITS 0xffu
+#define PF_READER 0x100u
+#define PF_SPIN 64
+
+// combiner가 쓰기 락을 가진 채 publication list를 다시 비워 보는 최대 횟수 (26.10.19)
+#define FC_ROUNDS 4
+
+/*
+ * rwlock_combine()으로 올라온 일이다. 올린 writer의 스택에 있으며, done이 참이 되면 combiner는 더 건드리지 않는다.
+ */
+struct rwlock_fc {
+    void (*op)(void *);
+    void *arg;
+    struct rwlock_fc *next;
+    atomic_bool done;
+};
+
+// RWLOCK_BIGREADER에서 스레드가 쓰는 slot 번호, 처음 쓸 때 차례대로 나눠 줌 (26.10.19)
+static atomic_uint next_slot;
+static __thread int my_slot = -1;
+
+static int thread_slot(void)
+{
+    if (my_slot < 0)
+        my_slot = atomic_fetch_add_explicit(&next_slot, 1, memory_order_relaxed) % RWLOCK_NSLOT;
+    return my_slot;
+}
+
+static struct rwlock_slot *slot_of(rwlock_t *lock)
+{
+    return lock->slot + thread_slot();
+}
+
+#ifdef RWLOCK_PROFILE
+/*
+ * RWLOCK_PROFILE로 빌드하면 락마다 스레드 slot별로 아래 통계를 모은다. slot은 RWLOCK_BIGREADER와 같은
+ * 스레드 번호를 쓰고 캐시 라인에 맞춰 두므로, 스레드가 RWLOCK_NSLOT개 이하이면 통계를 고칠 때
+ * 다른 스레드와 라인을 다투지 않는다. 그보다 많으면 slot을 나눠 쓰는 스레드끼리 값 몇 개를 잃을 수 있다.
+ * 시간은 NTP 보정을 받지 않는 CLOCK_MONOTONIC_RAW로 재고, 히스토그램은 2의 거듭제곱 나노초 구간으로 센다.
+ * 락을 얻으려다 느린 경로로 들어가거나, 돌며 기다리거나, try와 timed에서 실패하면 경합으로 센다.
+ */
+struct rwlock_prof_class {
+    uint64_t attempts;                          /* 락을 얻으려 한 횟수 */
+    uint64_t contended;                         /* 그중 경합이 있었던 횟수 */
+    uint64_t wait_total;                        /* 얻기까지 기다린 시간의 합(ns) */
+    uint64_t hold_total;                        /* 가지고 있던 시간의 합(ns) */
+    uint64_t wait[RWLOCK_PROF_NBUCKET];         /* 기다린 시간 히스토그램 */
+    uint64_t hold[RWLOCK_PROF_NBUCKET];         /* 가지고 있던 시간 히스토그램 */
+};
+
+struct rwlock_prof_slot {
+    _Alignas(RWLOCK_CACHELINE) struct rwlock_prof_class cls[RWLOCK_PROF_NCLASS];
+    uint64_t since[RWLOCK_PROF_NCLASS];         /* 이 slot의 스레드가 락을 얻은 시각 */
+};
+
+struct rwlock_prof {
+    struct rwlock_prof_slot slot[RWLOCK_NSLOT];
+    struct rwlock_prof *next;                   /* 살아 있는 락의 통계 목록, 프로그램이 끝날 때 출력함 */
+    rwlock_t *lock;
+};
+
+static pthread_mutex_t prof_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t prof_once = PTHREAD_ONCE_INIT;
+static struct rwlock_prof *prof_list;
+static __thread bool prof_contended;
+
+#define PROF_CONTENDED() (prof_contended = true)
+
+static uint64_t prof_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * slot을 나눠 쓰는 스레드가 있어도 경쟁 조건이 되지 않도록 relaxed로 읽고 쓴다. 그사이 끼어든 값은 잃는다.
+ */
+static void prof_add(uint64_t *p, uint64_t v)
+{
+    __atomic_store_n(p, __atomic_load_n(p, __ATOMIC_RELAXED) + v, __ATOMIC_RELAXED);
+}
+
+static int prof_bucket(uint64_t ns)
+{
+    int b = ns == 0 ? 0 : 64 - __builtin_clzll(ns);
+
+    return b < RWLOCK_PROF_NBUCKET ? b : RWLOCK_PROF_NBUCKET - 1;
+}
+
+static void prof_exit(void)
+{
+    pthread_mutex_lock(&prof_mutex);
+    for (struct rwlock_prof *p = prof_list; p != NULL; p = p->next)
+        rwlock_prof_dump(p->lock, stderr);
+    pthread_mutex_unlock(&prof_mutex);
+}
+
+static void prof_register_exit(void)
+{
+    atexit(prof_exit);
+}
+
+/*
+ * 통계를 만들어 살아 있는 락 목록에 넣는다. 처음 만들 때 프로그램이 끝나면 출력하도록 등록한다.
+ */
+static bool prof_init(rwlock_t *lock)
+{
+    struct rwlock_prof *p = aligned_alloc(RWLOCK_CACHELINE, sizeof(struct rwlock_prof));
+
+    if ((lock->prof = p) == NULL)
+        return false;
+    memset(p, 0, sizeof(*p));
+    p->lock = lock;
+    pthread_once(&prof_once, prof_register_exit);
+    pthread_mutex_lock(&prof_mutex);
+    p->next = prof_list;
+    prof_list = p;
+    pthread_mutex_unlock(&prof_mutex);
+    return true;
+}
+
+/*
+ * 락을 없애기 전에 통계를 출력하고 목록에서 뺀다.
+ */
+static void prof_destroy(rwlock_t *lock)
+{
+    struct rwlock_prof **pp;
+
+    rwlock_prof_dump(lock, stderr);
+    pthread_mutex_lock(&prof_mutex);
+    for (pp = &prof_list; *pp != lock->prof; pp = &(*pp)->next)
+        ;
+    *pp = lock->prof->next;
+    pthread_mutex_unlock(&prof_mutex);
+    free(lock->prof);
+}
+
+static uint64_t prof_enter(void)
+{
+    prof_contended = false;
+    return prof_now();
+}
+
+/*
+ * 기다림 없이 락을 얻은 시각만 적어 둔다. rwlock_downgrade()가 쓴다.
+ */
+static void prof_hold(rwlock_t *lock, int class)
+{
+    __atomic_store_n(&lock->prof->slot[thread_slot()].since[class], prof_now(), __ATOMIC_RELAXED);
+}
+
+/*
+ * t0부터 시작한 시도의 결과 rc를 기록하고 그대로 돌려준다. 얻지 못한 시도는 경합으로만 센다.
+ */
+static int prof_acquired(rwlock_t *lock, int class, uint64_t t0, int rc)
+{
+    struct rwlock_prof_slot *s = &lock->prof->slot[thread_slot()];
+    struct rwlock_prof_class *c = &s->cls[class];
+    uint64_t now, wait;
+
+    prof_add(&c->attempts, 1);
+    if (rc != RWLOCK_SUCCESS) {
+        prof_add(&c->contended, 1);
+        return rc;
+    }
+    now = prof_now();
+    wait = now - t0;
+    if (prof_contended)
+        prof_add(&c->contended, 1);
+    prof_add(&c->wait_total, wait);
+    prof_add(&c->wait[prof_bucket(wait)], 1);
+    __atomic_store_n(&s->since[class], now, __ATOMIC_RELAXED);
+    return rc;
+}
+
+/*
+ * 락을 놓기 직전에 부른다. 같은 스레드가 같은 락의 읽기 락을 겹쳐 얻으면 마지막으로 얻은 시각부터 잰다.
+ */
+static void prof_released(rwlock_t *lock, int class)
+{
+    struct rwlock_prof_slot *s = &lock->prof->slot[thread_slot()];
+    uint64_t hold = prof_now() - __atomic_load_n(&s->since[class], __ATOMIC_RELAXED);
+
+    prof_add(&s->cls[class].hold_total, hold);
+    prof_add(&s->cls[class].hold[prof_bucket(hold)], 1);
+}
+#else
+#define PROF_CONTENDED() ((void)0)
+
+static bool prof_init(rwlock_t *lock)
+{
+    lock->prof = NULL;
+    return true;
+}
+
+static void prof_destroy(rwlock_t *lock)
+{
+}
+
+static uint64_t prof_enter(void)
+{
+    return 0;
+}
+
+static void prof_hold(rwlock_t *lock, int class)
+{
+}
+
+static int prof_acquired(rwlock_t *lock, int class, uint64_t t0, int rc)
+{
+    return rc;
+}
+
+static void prof_released(rwlock_t *lock, int class)
+{
+}
+#endif
+
+/*
+ * upgrade_mutex를 잡는다. 이미 잡혀 있으면 경합으로 센 뒤 기다린다.
+ */
+static void upgrade_mutex_lock(rwlock_t *lock)
+{
+    if (pthread_mutex_trylock(&lock->upgrade_mutex) != 0) {
+        PROF_CONTENDED();
+        pthread_mutex_lock(&lock->upgrade_mutex);
+    }
+}
+
+/*
+ * 경합이 없을 때 state에 대한 CAS만으로 읽기 락을 얻는다.
+ * reader 우선이면 writer가 락을 가졌을 때만 물러나고, 나머지 정책은 기다리는 스레드가 있어도 물러나서
+ * 느린 경로에서 차례를 지키게 한다.
+ */
+static bool rd_fast(rwlock_t *lock)
+{
+    uint32_t mask = lock->policy == RWLOCK_READER ? RW_WRITER : RW_WRITER | RW_WAITING;
+    uint32_t s = atomic_load_explicit(&lock->state, memory_order_relaxed);
+
+    while (!(s & mask))
+        if (atomic_compare_exchange_weak_explicit(&lock->state, &s, s + RW_READER,
+                                                  memory_order_acquire, memory_order_relaxed))
+            return true;
+    return false;
+}
+
+/*
+ * 느린 경로에서 mutex를 쥔 채 읽기 락을 얻어 본다.
+ */
+static bool rd_try_locked(rwlock_t *lock)
+{
+    uint32_t s = atomic_load_explicit(&lock->state, memory_order_relaxed);
+
+    if (lock->policy == RWLOCK_WRITER && lock->writer_wait > 0)
+        return false;
+    if (lock->policy != RWLOCK_READER && lock->upgrade_wait > 0)
+        return false;
+    while (!(s & RW_WRITER))
+        if (atomic_compare_exchange_weak_explicit(&lock->state, &s, s + RW_READER,
+                                                  memory_order_acquire, memory_order_relaxed))
+            return true;
+    return false;
+}
+
+/*
+ * 아무도 락을 갖지 않았으면 writer 비트를 세운다. 대기 비트는 그대로 둔다.
+ */
+static bool wr_try(rwlock_t *lock)
+{
+    uint32_t s = atomic_load_explicit(&lock->state, memory_order_relaxed);
+
+    while (!(s & ~RW_WAITING))
+        if (atomic_compare_exchange_weak_explicit(&lock->state, &s, s | RW_WRITER,
+                                                  memory_order_seq_cst, memory_order_relaxed))
+            return true;
+    return false;
+}
+
+/*
+ * 읽기 락 하나만 가진 upgrader가 writer 비트로 바꿔 본다.
+ */
+static bool up_try(rwlock_t *lock)
+{
+    uint32_t s = atomic_load_explicit(&lock->state, memory_order_relaxed);
+
+    while ((s & ~RW_WAITING) == RW_READER)
+        if (atomic_compare_exchange_weak_explicit(&lock->state, &s, (s - RW_READER) | RW_WRITER,
+                                                  memory_order_seq_cst, memory_order_relaxed))
+            return true;
+    return false;
+}
+
+/*
+ * mutex를 쥔 채 기다리는 스레드를 깨운다. RWLOCK_FAIR는 누가 맨 앞인지 모르므로 모두 깨운다.
+ */
+static void wake(rwlock_t *lock, bool readers)
+{
+    if (lock->upgrade_wait > 0)
+        pthread_cond_signal(&lock->upgrade_cond);
+    if (lock->policy == RWLOCK_FAIR) {
+        pthread_cond_broadcast(&lock->reader_cond);
+        pthread_cond_broadcast(&lock->writer_cond);
+        return;
+    }
+    if (readers && lock->reader_wait > 0)
+        pthread_cond_broadcast(&lock->reader_cond);
+    if (lock->writer_wait > 0)
+        pthread_cond_signal(&lock->writer_cond);
+}
+
+/*
+ * abstime이 NULL이면 그냥 기다리고, 아니면 그 시각까지만 기다린다.
+ */
+static int cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex, const struct timespec *abstime)
+{
+    if (abstime == NULL)
+        return pthread_cond_wait(cond, mutex);
+    return pthread_cond_timedwait(cond, mutex, abstime);
+}
+
+/*
+ * 돌면서 기다리는 곳에서 기한이 지났는지 확인한다.
+ */
+static bool expired(const struct timespec *abstime)
+{
+    struct timespec now;
+
+    if (abstime == NULL)
+        return false;
+    clock_gettime(CLOCK_REALTIME, &now);
+    return now.tv_sec > abstime->tv_sec || (now.tv_sec == abstime->tv_sec && now.tv_nsec >= abstime->tv_nsec);
+}
+
+/*
+ * mutex를 쥔 채 RWLOCK_FAIR의 줄 맨 뒤에 선다.
+ */
+static void enqueue(rwlock_t *lock, struct rwlock_waiter *me)
+{
+    me->next = NULL;
+    if (lock->tail != NULL)
+        lock->tail->next = me;
+    else
+        lock->head = me;
+    lock->tail = me;
+}
+
+/*
+ * 느린 경로를 빠져나가면서 RWLOCK_FAIR의 줄에서 빠지고, 기다리는 스레드가 더 없으면 대기 비트를 지운다.
+ * 락을 얻어서든 기한이 지나서든 맨 앞이 빠지면 다음 스레드가 맨 앞이 되므로 깨운다.
+ * 줄에 서지 않은 스레드는 me를 NULL로 넘긴다.
+ */
+static void leave(rwlock_t *lock, struct rwlock_waiter *me)
+{
+    struct rwlock_waiter **p, *prev = NULL;
+
+    if (lock->policy == RWLOCK_FAIR && me != NULL) {
+        for (p = &lock->head; *p != me; p = &(*p)->next)
+            prev = *p;
+        *p = me->next;
+        if (lock->tail == me)
+            lock->tail = prev;
+        if (prev == NULL && lock->head != NULL)
+            wake(lock, true);
+    }
+    if (lock->reader_wait == 0 && lock->writer_wait == 0 && lock->upgrade_wait == 0)
+        atomic_fetch_and_explicit(&lock->state, ~RW_WAITING, memory_order_relaxed);
+}
+
+/*
+ * RWLOCK_BIGREADER의 읽기 락이다. 자기 slot을 올린 뒤 writer 비트가 없으면 그대로 들어간다.
+ * writer 비트가 있으면 slot을 되돌리고, writer가 나갈 때까지 reader_cond에서 기다렸다가 다시 해 본다.
+ * slot을 올리고 state를 읽는 순서와 writer가 state를 바꾸고 slot을 읽는 순서가 엇갈리므로,
+ * 둘 중 적어도 한쪽은 상대를 보게 된다. abstime이 NULL이 아니면 try 또는 timed로 동작한다.
+ */
+static int big_rdlock(rwlock_t *lock, bool try, const struct timespec *abstime)
+{
+    struct rwlock_slot *slot = slot_of(lock);
+    int rc = 0;
+
+    for (;;) {
+        atomic_fetch_add_explicit(&slot->readers, 1, memory_order_seq_cst);
+        if (!(atomic_load_explicit(&lock->state, memory_order_seq_cst) & RW_WRITER))
+            return RWLOCK_SUCCESS;
+        atomic_fetch_sub_explicit(&slot->readers, 1, memory_order_release);
+        if (try)
+            return RWLOCK_BUSY;
+        PROF_CONTENDED();
+        pthread_mutex_lock(&lock->mutex);
+        lock->reader_wait++;
+        atomic_fetch_or_explicit(&lock->state, RW_WAITING, memory_order_relaxed);
+        while (rc != ETIMEDOUT && atomic_load_explicit(&lock->state, memory_order_relaxed) & RW_WRITER)
+            rc = cond_wait(&lock->reader_cond, &lock->mutex, abstime);
+        lock->reader_wait--;
+        leave(lock, NULL);
+        pthread_mutex_unlock(&lock->mutex);
+        if (rc == ETIMEDOUT)
+            return RWLOCK_TIMEOUT;
+    }
+}
+
+/*
+ * RWLOCK_BIGREADER에서 writer 비트를 세운 writer가 slot에 남은 reader가 모두 나가기를 기다린다.
+ * 새 reader는 writer 비트를 보고 물러나므로 기다림은 이미 들어와 있던 reader의 임계구역 길이로 끝난다.
+ * writer 비트를 세우는 CAS와 여기의 읽기가 모두 seq_cst여야 big_rdlock()과 서로를 놓치지 않는다.
+ * try이거나 abstime이 지나면 기다림을 그만두고 거짓을 돌려준다.
+ */
+static bool big_drain(rwlock_t *lock, bool try, const struct timespec *abstime)
+{
+    for (int i = 0; i < RWLOCK_NSLOT; i++)
+        while (atomic_load_explicit(&lock->slot[i].readers, memory_order_seq_cst) != 0) {
+            if (try || expired(abstime))
+                return false;
+            PROF_CONTENDED();
+            sched_yield();
+        }
+    return true;
+}
+
+/*
+ * 기다리며 도는 횟수가 PF_SPIN을 넘으면 CPU를 양보한다.
+ */
+static void pf_relax(int *spin)
+{
+    PROF_CONTENDED();
+    if (++*spin > PF_SPIN)
+        sched_yield();
+}
+
+/*
+ * RWLOCK_PHASEFAIR의 읽기 락이다. 경합이 없으면 fetch-add 한 번으로 끝난다.
+ * 들어올 때 writer 표시가 있었다면 바로 그 표시가 없어질 때까지만 기다린다. 표시마다 세대가 다르므로
+ * 그사이 다음 writer가 표시를 해도 이 reader는 멈추지 않는다.
+ */
+static int pf_rdlock(rwlock_t *lock)
+{
+    uint32_t w = atomic_fetch_add_explicit(&lock->rin, PF_READER, memory_order_acquire) & PF_WBITS;
+    int spin = 0;
+
+    if (w != 0)
+        while ((atomic_load_explicit(&lock->rin, memory_order_acquire) & PF_WBITS) == w)
+            pf_relax(&spin);
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * RWLOCK_PHASEFAIR에서 writer 표시가 없을 때만 rin을 올리는 읽기 락이다. try와 timed 함수가 쓴다.
+ * 표시가 있는데 rin을 올려 버리면 writer가 세어 둔 reader 수와 어긋나서 물릴 수 없기 때문이다.
+ */
+static int pf_tryrdlock(rwlock_t *lock)
+{
+    uint32_t r = atomic_load_explicit(&lock->rin, memory_order_relaxed);
+
+    while (!(r & PF_WBITS))
+        if (atomic_compare_exchange_weak_explicit(&lock->rin, &r, r + PF_READER,
+                                                  memory_order_acquire, memory_order_relaxed))
+            return RWLOCK_SUCCESS;
+    return RWLOCK_BUSY;
+}
+
+/*
+ * RWLOCK_PHASEFAIR의 쓰기 락을 놓는다. writer 표시를 지워 기다리던 reader를 들여보내고 다음 번호표로 넘긴다.
+ */
+static int pf_wrunlock(rwlock_t *lock)
+{
+    atomic_fetch_and_explicit(&lock->rin, ~PF_WBITS, memory_order_release);
+    atomic_fetch_add_explicit(&lock->wout, 1, memory_order_release);
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * 차례를 얻은 writer가 rin에 더할 다음 writer 표시를 구한다. 세대를 하나 올려 바로 앞 표시와 다르게 한다.
+ * 세대는 표시를 실제로 했을 때만 wmark에 남긴다. 표시하지 못한 try와 timed 쓰기까지 세대를 올리면
+ * 세대가 한 바퀴 돌아 기다리는 reader가 본 표시와 같아질 수 있다.
+ */
+static uint32_t pf_mark(rwlock_t *lock)
+{
+    return PF_PRESENT | ((lock->wmark + PF_GEN) & (PF_WBITS & ~PF_PRESENT));
+}
+
+/*
+ * RWLOCK_PHASEFAIR의 쓰기 락이다. writer끼리는 번호표 순서를 지키고, 차례가 되면 rin에 자기 표시를 더해
+ * 새 reader를 막은 뒤 그 순간까지 들어온 reader가 모두 나가기를 기다린다.
+ * 표시의 세대는 표시할 때마다 바뀌므로, 앞 writer의 표시를 본 reader가 뒤 writer 때문에 더 기다리지 않는다.
+ * 세대를 번호표로 정하지 않는 것은 upgrade하지 않고 나가는 upgrader처럼 표시하지 않는 차례가 있기 때문이다.
+ * try이거나 abstime이 있으면 번호표를 뽑는 대신 아무도 번호표를 갖고 있지 않을 때 win을 CAS로 올려 차례를 얻고,
+ * 안에 남은 reader가 없을 때만 rin을 CAS로 바꿔 표시한다. reader가 남아 있으면 표시하지 않고 차례만 넘긴다.
+ * 표시한 뒤 기다리다 포기하면 그 표시를 보고 세어진 reader가 다음 writer의 표시를 자기 것으로 알고
+ * 멈출 수 있으므로, 한 번 한 표시는 reader가 모두 나갈 때까지 거두지 않는다.
+ */
+static int pf_wrlock(rwlock_t *lock, bool try, const struct timespec *abstime)
+{
+    uint32_t ticket, rticket, r, mark;
+    int spin = 0;
+
+    if (!try && abstime == NULL) {
+        ticket = atomic_fetch_add_explicit(&lock->win, 1, memory_order_relaxed);
+        while (atomic_load_explicit(&lock->wout, memory_order_acquire) != ticket)
+            pf_relax(&spin);
+        lock->wmark = pf_mark(lock);
+        rticket = atomic_fetch_add_explicit(&lock->rin, lock->wmark, memory_order_acquire);
+        while (atomic_load_explicit(&lock->rout, memory_order_acquire) != rticket)
+            pf_relax(&spin);
+        return RWLOCK_SUCCESS;
+    }
+    for (;;) {
+        ticket = atomic_load_explicit(&lock->wout, memory_order_acquire);
+        if (atomic_compare_exchange_strong_explicit(&lock->win, &ticket, ticket + 1,
+                                                    memory_order_acquire, memory_order_relaxed)) {
+            // 차례를 가진 동안에는 다른 표시가 없으므로 들어온 reader 수와 나간 reader 수만 비교함 (26.10.19)
+            mark = pf_mark(lock);
+            r = atomic_load_explicit(&lock->rin, memory_order_relaxed);
+            while ((r & ~PF_WBITS) == atomic_load_explicit(&lock->rout, memory_order_acquire))
+                if (atomic_compare_exchange_weak_explicit(&lock->rin, &r, r | mark,
+                                                          memory_order_acquire, memory_order_relaxed)) {
+                    lock->wmark = mark;
+                    return RWLOCK_SUCCESS;
+                }
+            atomic_fetch_add_explicit(&lock->wout, 1, memory_order_release);
+        }
+        if (try)
+            return RWLOCK_BUSY;
+        if (expired(abstime))
+            return RWLOCK_TIMEOUT;
+        pf_relax(&spin);
+    }
+}
+
+/*
+ * 락을 초기화한다. 알 수 없는 정책이면 RWLOCK_FAIL을 돌려준다.
+ */
+int rwlock_init(rwlock_t *lock, int policy)
+{
+    if (policy < RWLOCK_READER || policy > RWLOCK_PHASEFAIR)
+        return RWLOCK_FAIL;
+    atomic_init(&lock->state, 0);
+    lock->policy = policy;
+    lock->reader_wait = lock->writer_wait = lock->upgrade_wait = 0;
+    lock->head = lock->tail = NULL;
+    lock->slot = NULL;
+    atomic_init(&lock->rin, 0);
+    atomic_init(&lock->rout, 0);
+    atomic_init(&lock->win, 0);
+    atomic_init(&lock->wout, 0);
+    lock->wmark = 0;
+    atomic_init(&lock->fc_list, NULL);
+    atomic_init(&lock->fc_busy, false);
+    if (policy == RWLOCK_BIGREADER) {
+        if ((lock->slot = aligned_alloc(RWLOCK_CACHELINE, sizeof(struct rwlock_slot) * RWLOCK_NSLOT)) == NULL)
+            return RWLOCK_FAIL;
+        for (int i = 0; i < RWLOCK_NSLOT; i++)
+            atomic_init(&lock->slot[i].readers, 0);
+    }
+    if (pthread_mutex_init(&lock->mutex, NULL) != 0) {
+        free(lock->slot);
+        return RWLOCK_FAIL;
+    }
+    if (!prof_init(lock)) {
+        pthread_mutex_destroy(&lock->mutex);
+        free(lock->slot);
+        return RWLOCK_FAIL;
+    }
+    pthread_mutex_init(&lock->upgrade_mutex, NULL);
+    pthread_cond_init(&lock->reader_cond, NULL);
+    pthread_cond_init(&lock->writer_cond, NULL);
+    pthread_cond_init(&lock->upgrade_cond, NULL);
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * 락이 쓰던 자원을 돌려준다. 아무도 락을 갖거나 기다리지 않을 때 불러야 한다.
+ */
+int rwlock_destroy(rwlock_t *lock)
+{
+    if (atomic_load(&lock->state) != 0 || atomic_load(&lock->rin) != atomic_load(&lock->rout)
+        || atomic_load(&lock->win) != atomic_load(&lock->wout) || atomic_load(&lock->fc_list) != NULL)
+        return RWLOCK_FAIL;
+    prof_destroy(lock);
+    pthread_mutex_destroy(&lock->mutex);
+    pthread_mutex_destroy(&lock->upgrade_mutex);
+    pthread_cond_destroy(&lock->reader_cond);
+    pthread_cond_destroy(&lock->writer_cond);
+    pthread_cond_destroy(&lock->upgrade_cond);
+    free(lock->slot);
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * state 워드를 쓰는 정책의 읽기 락 느린 경로이다. mutex를 잡고 대기 비트를 세운 뒤, 정책이 허락할 때까지
+ * reader_cond에서 기다린다. 대기 비트를 세운 다음 state를 다시 보므로 그 사이에 락이 풀렸다면 놓치지 않는다.
+ * RWLOCK_FAIR에서는 줄의 맨 앞이 되어야 들어간다.
+ */
+static int rd_slow(rwlock_t *lock, const struct timespec *abstime)
+{
+    struct rwlock_waiter me;
+    int rc = 0;
+
+    PROF_CONTENDED();
+    pthread_mutex_lock(&lock->mutex);
+    lock->reader_wait++;
+    atomic_fetch_or_explicit(&lock->state, RW_WAITING, memory_order_relaxed);
+    if (lock->policy == RWLOCK_FAIR)
+        enqueue(lock, &me);
+    while ((lock->policy == RWLOCK_FAIR && lock->head != &me) || !rd_try_locked(lock))
+        if ((rc = cond_wait(&lock->reader_cond, &lock->mutex, abstime)) == ETIMEDOUT)
+            break;
+    lock->reader_wait--;
+    leave(lock, &me);
+    pthread_mutex_unlock(&lock->mutex);
+    return rc == ETIMEDOUT ? RWLOCK_TIMEOUT : RWLOCK_SUCCESS;
+}
+
+/*
+ * state 워드를 쓰는 정책의 쓰기 락 느린 경로이다. 기다리다 기한이 지난 writer는 writer_wait을 되돌리고,
+ * writer 우선 정책에서 자기 때문에 막혀 있던 reader와 자기가 받았을지 모르는 signal을 기다리던 writer를 깨운다.
+ */
+static int wr_slow(rwlock_t *lock, const struct timespec *abstime)
+{
+    struct rwlock_waiter me;
+    int rc = 0;
+
+    PROF_CONTENDED();
+    pthread_mutex_lock(&lock->mutex);
+    lock->writer_wait++;
+    atomic_fetch_or_explicit(&lock->state, RW_WAITING, memory_order_relaxed);
+    if (lock->policy == RWLOCK_FAIR)
+        enqueue(lock, &me);
+    while ((lock->policy == RWLOCK_FAIR && lock->head != &me) || !wr_try(lock))
+        if ((rc = cond_wait(&lock->writer_cond, &lock->mutex, abstime)) == ETIMEDOUT)
+            break;
+    lock->writer_wait--;
+    if (rc == ETIMEDOUT)
+        wake(lock, lock->policy != RWLOCK_WRITER || lock->writer_wait == 0);
+    leave(lock, &me);
+    pthread_mutex_unlock(&lock->mutex);
+    return rc == ETIMEDOUT ? RWLOCK_TIMEOUT : RWLOCK_SUCCESS;
+}
+
+/*
+ * 읽기 락을 얻는다. 빠른 경로가 실패하면 정책에 맞는 느린 경로에서 기다린다.
+ */
+static int raw_rdlock(rwlock_t *lock)
+{
+    if (lock->policy == RWLOCK_BIGREADER)
+        return big_rdlock(lock, false, NULL);
+    if (lock->policy == RWLOCK_PHASEFAIR)
+        return pf_rdlock(lock);
+    if (rd_fast(lock))
+        return RWLOCK_SUCCESS;
+    return rd_slow(lock, NULL);
+}
+
+/*
+ * 읽기 락을 놓는다. 마지막 reader이고 기다리는 스레드가 있으면 writer를 깨운다.
+ */
+static int raw_rdunlock(rwlock_t *lock)
+{
+    uint32_t s;
+
+    if (lock->policy == RWLOCK_BIGREADER) {
+        atomic_fetch_sub_explicit(&slot_of(lock)->readers, 1, memory_order_release);
+        return RWLOCK_SUCCESS;
+    }
+    if (lock->policy == RWLOCK_PHASEFAIR) {
+        atomic_fetch_add_explicit(&lock->rout, PF_READER, memory_order_release);
+        return RWLOCK_SUCCESS;
+    }
+    s = atomic_fetch_sub_explicit(&lock->state, RW_READER, memory_order_release) - RW_READER;
+    if (s == RW_WAITING) {
+        pthread_mutex_lock(&lock->mutex);
+        wake(lock, false);
+        pthread_mutex_unlock(&lock->mutex);
+    } else if (s == (RW_READER | RW_WAITING)) {
+        // 남은 reader 하나가 upgrade를 기다리는 upgrader일 수 있음 (26.10.19)
+        pthread_mutex_lock(&lock->mutex);
+        if (lock->upgrade_wait > 0)
+            pthread_cond_signal(&lock->upgrade_cond);
+        pthread_mutex_unlock(&lock->mutex);
+    }
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * 쓰기 락을 얻는다. 경합이 없으면 state를 0에서 writer 비트로 바꾸는 CAS 한 번으로 끝난다.
+ * RWLOCK_BIGREADER는 upgrader와 같은 upgrade_mutex로 writer끼리 줄을 선 뒤 writer 비트를 얻고,
+ * slot의 reader가 모두 나갈 때까지 더 기다린다.
+ */
+static int raw_wrlock(rwlock_t *lock)
+{
+    uint32_t s = 0;
+
+    if (lock->policy == RWLOCK_PHASEFAIR)
+        return pf_wrlock(lock, false, NULL);
+    if (lock->policy == RWLOCK_BIGREADER)
+        upgrade_mutex_lock(lock);
+    if (!atomic_compare_exchange_strong_explicit(&lock->state, &s, RW_WRITER,
+                                                 memory_order_seq_cst, memory_order_relaxed))
+        wr_slow(lock, NULL);
+    if (lock->policy == RWLOCK_BIGREADER)
+        big_drain(lock, false, NULL);
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * 쓰기 락을 놓는다. 기다리는 스레드가 있으면 reader는 모두, writer는 하나를 깨운다.
+ * writer 우선이면 기다리는 writer가 남아 있는 동안 reader는 깨우지 않는다.
+ */
+static int raw_wrunlock(rwlock_t *lock)
+{
+    uint32_t s;
+
+    if (lock->policy == RWLOCK_PHASEFAIR)
+        return pf_wrunlock(lock);
+    s = atomic_fetch_sub_explicit(&lock->state, RW_WRITER, memory_order_release);
+    if (s & RW_WAITING) {
+        pthread_mutex_lock(&lock->mutex);
+        wake(lock, lock->policy != RWLOCK_WRITER || lock->writer_wait == 0);
+        pthread_mutex_unlock(&lock->mutex);
+    }
+    if (lock->policy == RWLOCK_BIGREADER)
+        pthread_mutex_unlock(&lock->upgrade_mutex);
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * 기다리지 않고 읽기 락을 얻어 본다. 바로 얻을 수 없으면 RWLOCK_BUSY를 돌려준다.
+ */
+static int raw_tryrdlock(rwlock_t *lock)
+{
+    if (lock->policy == RWLOCK_BIGREADER)
+        return big_rdlock(lock, true, NULL);
+    if (lock->policy == RWLOCK_PHASEFAIR)
+        return pf_tryrdlock(lock);
+    return rd_fast(lock) ? RWLOCK_SUCCESS : RWLOCK_BUSY;
+}
+
+/*
+ * 기다리지 않고 쓰기 락을 얻어 본다. 아무도 락을 갖거나 기다리지 않을 때만 얻으므로 줄을 선 스레드를 앞지르지 않는다.
+ * RWLOCK_BIGREADER는 writer 비트를 세운 뒤 slot에 reader가 남아 있으면 wrunlock으로 물린다.
+ */
+static int raw_trywrlock(rwlock_t *lock)
+{
+    uint32_t s = 0;
+
+    if (lock->policy == RWLOCK_PHASEFAIR)
+        return pf_wrlock(lock, true, NULL);
+    if (lock->policy == RWLOCK_BIGREADER && pthread_mutex_trylock(&lock->upgrade_mutex) != 0)
+        return RWLOCK_BUSY;
+    if (!atomic_compare_exchange_strong_explicit(&lock->state, &s, RW_WRITER,
+                                                 memory_order_seq_cst, memory_order_relaxed)) {
+        if (lock->policy == RWLOCK_BIGREADER)
+            pthread_mutex_unlock(&lock->upgrade_mutex);
+        return RWLOCK_BUSY;
+    }
+    if (lock->policy == RWLOCK_BIGREADER && !big_drain(lock, true, NULL)) {
+        raw_wrunlock(lock);
+        return RWLOCK_BUSY;
+    }
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * 읽기 락을 얻되 abstime까지 얻지 못하면 RWLOCK_TIMEOUT을 돌려준다.
+ * RWLOCK_PHASEFAIR는 writer 표시가 없어질 때까지 양보하며 다시 해 본다.
+ */
+static int raw_timedrdlock(rwlock_t *lock, const struct timespec *abstime)
+{
+    int spin = 0;
+
+    switch (lock->policy) {
+        case RWLOCK_BIGREADER:
+            return big_rdlock(lock, false, abstime);
+        case RWLOCK_PHASEFAIR:
+            while (pf_tryrdlock(lock) != RWLOCK_SUCCESS) {
+                if (expired(abstime))
+                    return RWLOCK_TIMEOUT;
+                pf_relax(&spin);
+            }
+            return RWLOCK_SUCCESS;
+    }
+    if (rd_fast(lock))
+        return RWLOCK_SUCCESS;
+    return rd_slow(lock, abstime);
+}
+
+/*
+ * 쓰기 락을 얻되 abstime까지 얻지 못하면 RWLOCK_TIMEOUT을 돌려준다.
+ * RWLOCK_BIGREADER에서 writer 비트를 세운 뒤 reader가 나가기를 기다리다 기한이 지나면 wrunlock으로 물린다.
+ */
+static int raw_timedwrlock(rwlock_t *lock, const struct timespec *abstime)
+{
+    uint32_t s = 0;
+
+    if (lock->policy == RWLOCK_PHASEFAIR)
+        return pf_wrlock(lock, false, abstime);
+    if (lock->policy == RWLOCK_BIGREADER && pthread_mutex_timedlock(&lock->upgrade_mutex, abstime) != 0)
+        return RWLOCK_TIMEOUT;
+    if (!atomic_compare_exchange_strong_explicit(&lock->state, &s, RW_WRITER,
+                                                 memory_order_seq_cst, memory_order_relaxed)
+        && wr_slow(lock, abstime) == RWLOCK_TIMEOUT) {
+        if (lock->policy == RWLOCK_BIGREADER)
+            pthread_mutex_unlock(&lock->upgrade_mutex);
+        return RWLOCK_TIMEOUT;
+    }
+    if (lock->policy == RWLOCK_BIGREADER && !big_drain(lock, false, abstime)) {
+        raw_wrunlock(lock);
+        return RWLOCK_TIMEOUT;
+    }
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * upgrade할 수 있는 읽기 락을 얻는다. 보통 reader와는 함께 들어가지만 다른 upgrader나 writer와는
+ * 함께 들어가지 않는다. RWLOCK_PHASEFAIR는 writer 번호표의 차례를 받아 writer를 막은 채 reader로 들어가고,
+ * 그 밖의 정책은 upgrade_mutex로 upgrader를 하나로 제한한 뒤 읽기 락을 얻는다.
+ * 읽기 락을 가진 upgrader가 있으면 writer는 들어갈 수 없으므로 따로 막을 필요가 없고,
+ * RWLOCK_BIGREADER의 writer는 upgrade_mutex부터 잡으므로 역시 막힌다.
+ */
+static int raw_uplock(rwlock_t *lock)
+{
+    uint32_t ticket;
+    int spin = 0;
+
+    if (lock->policy == RWLOCK_PHASEFAIR) {
+        ticket = atomic_fetch_add_explicit(&lock->win, 1, memory_order_relaxed);
+        while (atomic_load_explicit(&lock->wout, memory_order_acquire) != ticket)
+            pf_relax(&spin);
+        return pf_rdlock(lock);
+    }
+    upgrade_mutex_lock(lock);
+    return raw_rdlock(lock);
+}
+
+/*
+ * upgrade하지 않고 upgrade할 수 있는 읽기 락을 놓는다.
+ */
+static int raw_upunlock(rwlock_t *lock)
+{
+    raw_rdunlock(lock);
+    if (lock->policy == RWLOCK_PHASEFAIR)
+        atomic_fetch_add_explicit(&lock->wout, 1, memory_order_release);
+    else
+        pthread_mutex_unlock(&lock->upgrade_mutex);
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * upgrade할 수 있는 읽기 락을 쓰기 락으로 바꾼다. 락을 놓지 않으므로 그사이 다른 writer가 끼어들지 않고,
+ * 이후에는 rwlock_wrunlock()으로 놓는다. 다른 reader가 모두 나갈 때까지 기다리며, 기다리는 동안
+ * RWLOCK_READER를 뺀 정책에서는 새 reader가 들어오지 않는다.
+ */
+static int raw_upgrade(rwlock_t *lock)
+{
+    uint32_t rticket, s;
+    int spin = 0;
+
+    switch (lock->policy) {
+        case RWLOCK_PHASEFAIR:
+            // writer 표시로 새 reader를 막은 뒤 자기 읽기를 빼고, 앞서 들어온 reader가 나가기를 기다림 (26.10.19)
+            lock->wmark = pf_mark(lock);
+            rticket = atomic_fetch_add_explicit(&lock->rin, lock->wmark, memory_order_acquire);
+            atomic_fetch_add_explicit(&lock->rout, PF_READER, memory_order_release);
+            while (atomic_load_explicit(&lock->rout, memory_order_acquire) != rticket)
+                pf_relax(&spin);
+            return RWLOCK_SUCCESS;
+        case RWLOCK_BIGREADER:
+            // writer는 upgrade_mutex를 먼저 잡으므로 writer 비트는 비어 있음 (26.10.19)
+            s = atomic_load_explicit(&lock->state, memory_order_relaxed);
+            while (!atomic_compare_exchange_weak_explicit(&lock->state, &s, s | RW_WRITER,
+                                                          memory_order_seq_cst, memory_order_relaxed))
+                ;
+            atomic_fetch_sub_explicit(&slot_of(lock)->readers, 1, memory_order_release);
+            big_drain(lock, false, NULL);
+            return RWLOCK_SUCCESS;
+    }
+    if (!up_try(lock)) {
+        PROF_CONTENDED();
+        pthread_mutex_lock(&lock->mutex);
+        lock->upgrade_wait++;
+        atomic_fetch_or_explicit(&lock->state, RW_WAITING, memory_order_relaxed);
+        while (!up_try(lock))
+            pthread_cond_wait(&lock->upgrade_cond, &lock->mutex);
+        lock->upgrade_wait--;
+        leave(lock, NULL);
+        pthread_mutex_unlock(&lock->mutex);
+    }
+    pthread_mutex_unlock(&lock->upgrade_mutex);
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * 쓰기 락을 놓지 않고 읽기 락으로 바꾼다. 이후에는 rwlock_rdunlock()으로 놓는다.
+ * 자기 읽기를 먼저 더한 뒤 writer 표시를 지우므로 그사이 다른 writer가 끼어들지 않는다.
+ */
+static int raw_downgrade(rwlock_t *lock)
+{
+    uint32_t s;
+
+    switch (lock->policy) {
+        case RWLOCK_PHASEFAIR:
+            atomic_fetch_add_explicit(&lock->rin, PF_READER, memory_order_relaxed);
+            pf_wrunlock(lock);
+            return RWLOCK_SUCCESS;
+        case RWLOCK_BIGREADER:
+            atomic_fetch_add_explicit(&slot_of(lock)->readers, 1, memory_order_relaxed);
+            break;
+    }
+    if (lock->policy == RWLOCK_BIGREADER)
+        s = atomic_fetch_sub_explicit(&lock->state, RW_WRITER, memory_order_release);
+    else
+        s = atomic_fetch_add_explicit(&lock->state, RW_READER - RW_WRITER, memory_order_release);
+    if (s & RW_WAITING) {
+        pthread_mutex_lock(&lock->mutex);
+        if (lock->policy == RWLOCK_FAIR)
+            wake(lock, true);
+        else if (lock->reader_wait > 0 && (lock->policy != RWLOCK_WRITER || lock->writer_wait == 0))
+            pthread_cond_broadcast(&lock->reader_cond);
+        pthread_mutex_unlock(&lock->mutex);
+    }
+    if (lock->policy == RWLOCK_BIGREADER)
+        pthread_mutex_unlock(&lock->upgrade_mutex);
+    return RWLOCK_SUCCESS;
+}
+
+/*
+ * 아래는 바깥에 보이는 함수들로, 위의 구현을 부르면서 RWLOCK_PROFILE로 빌드했을 때 통계를 남긴다.
+ * 그렇지 않으면 통계 함수가 비어 있어 구현을 그대로 부르는 것과 같다.
+ */
+int rwlock_rdlock(rwlock_t *lock)
+{
+    uint64_t t0 = prof_enter();
+
+    return prof_acquired(lock, RWLOCK_PROF_READ, t0, raw_rdlock(lock));
+}
+
+int rwlock_rdunlock(rwlock_t *lock)
+{
+    prof_released(lock, RWLOCK_PROF_READ);
+    return raw_rdunlock(lock);
+}
+
+int rwlock_wrlock(rwlock_t *lock)
+{
+    uint64_t t0 = prof_enter();
+
+    return prof_acquired(lock, RWLOCK_PROF_WRITE, t0, raw_wrlock(lock));
+}
+
+int rwlock_wrunlock(rwlock_t *lock)
+{
+    prof_released(lock, RWLOCK_PROF_WRITE);
+    return raw_wrunlock(lock);
+}
+
+int rwlock_tryrdlock(rwlock_t *lock)
+{
+    uint64_t t0 = prof_enter();
+
+    return prof_acquired(lock, RWLOCK_PROF_READ, t0, raw_tryrdlock(lock));
+}
+
+int rwlock_trywrlock(rwlock_t *lock)
+{
+    uint64_t t0 = prof_enter();
+
+    return prof_acquired(lock, RWLOCK_PROF_WRITE, t0, raw_trywrlock(lock));
+}
+
+int rwlock_timedrdlock(rwlock_t *lock, const struct timespec *abstime)
+{
+    uint64_t t0 = prof_enter();
+
+    return prof_acquired(lock, RWLOCK_PROF_READ, t0, raw_timedrdlock(lock, abstime));
+}
+
+int rwlock_timedwrlock(rwlock_t *lock, const struct timespec *abstime)
+{
+    uint64_t t0 = prof_enter();
+
+    return prof_acquired(lock, RWLOCK_PROF_WRITE, t0, raw_timedwrlock(lock, abstime));
+}
+
+int rwlock_uplock(rwlock_t *lock)
+{
+    uint64_t t0 = prof_enter();
+
+    return prof_acquired(lock, RWLOCK_PROF_READ, t0, raw_uplock(lock));
+}
+
+int rwlock_upunlock(rwlock_t *lock)
+{
+    prof_released(lock, RWLOCK_PROF_READ);
+    return raw_upunlock(lock);
+}
+
+/*
+ * upgrade는 읽기 락을 놓고 쓰기 락을 얻는 것으로 센다.
+ */
+int rwlock_upgrade(rwlock_t *lock)
+{
+    uint64_t t0;
+
+    prof_released(lock, RWLOCK_PROF_READ);
+    t0 = prof_enter();
+    return prof_acquired(lock, RWLOCK_PROF_WRITE, t0, raw_upgrade(lock));
+}
+
+/*
+ * downgrade는 쓰기 락을 놓고 기다림 없이 읽기 락을 얻는 것으로 센다.
+ */
+int rwlock_downgrade(rwlock_t *lock)
+{
+    int rc;
+
+    prof_released(lock, RWLOCK_PROF_WRITE);
+    rc = raw_downgrade(lock);
+    prof_hold(lock, RWLOCK_PROF_READ);
+    return rc;
+}
+
+/*
+ * 쓰기 락을 가진 combiner가 publication list를 통째로 가져와 먼저 올라온 일부터 해 준다. 해 준 일의 수를 돌려준다.
+ * list는 올리는 쪽이 CAS로 앞에 붙이고 가져가는 쪽은 통째로 바꾸기만 하므로 ABA 문제가 없다.
+ */
+static int fc_run(rwlock_t *lock)
+{
+    struct rwlock_fc *p = atomic_exchange_explicit(&lock->fc_list, NULL, memory_order_acquire);
+    struct rwlock_fc *q = NULL, *next;
+    int n = 0;
+
+    for (; p != NULL; p = next) {
+        next = p->next;
+        p->next = q;
+        q = p;
+    }
+    for (; q != NULL; q = next, n++) {
+        next = q->next;
+        q->op(q->arg);
+        atomic_store_explicit(&q->done, true, memory_order_release);
+    }
+    return n;
+}
+
+/*
+ * op(arg)를 쓰기 락 아래에서 하게 하고, 끝나면 돌아온다. 일을 publication list에 올린 뒤 combiner가 없으면
+ * 스스로 combiner가 되어 쓰기 락을 얻고 list가 빌 때까지 FC_ROUNDS번까지 모두 해 준다.
+ * combiner가 있으면 자기 일이 끝나기를 기다리되, combiner가 자기 일을 가져가기 전에 나가 버렸으면 다시 해 본다.
+ * op는 다른 스레드에서 불릴 수 있으므로 스레드 지역 변수에 기대면 안 된다.
+ */
+int rwlock_combine(rwlock_t *lock, void (*op)(void *), void *arg)
+{
+    struct rwlock_fc me;
+    bool busy;
+    int spin = 0;
+
+    me.op = op;
+    me.arg = arg;
+    atomic_init(&me.done, false);
+    me.next = atomic_load_explicit(&lock->fc_list, memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(&lock->fc_list, &me.next, &me,
+                                                  memory_order_release, memory_order_relaxed))
+        ;
+    while (!atomic_load_explicit(&me.done, memory_order_acquire)) {
+        busy = false;
+        if (!atomic_load_explicit(&lock->fc_busy, memory_order_relaxed)
+            && atomic_compare_exchange_strong_explicit(&lock->fc_busy, &busy, true,
+                                                       memory_order_acquire, memory_order_relaxed)) {
+            rwlock_wrlock(lock);
+            for (int i = 0; i < FC_ROUNDS && fc_run(lock) > 0; i++)
+                ;
+            rwlock_wrunlock(lock);
+            atomic_store_explicit(&lock->fc_busy, false, memory_order_release);
+        } else
+            pf_relax(&spin);
+    }
+    return RWLOCK_SUCCESS;
+}
+
+#ifdef RWLOCK_PROFILE
+static uint64_t hist_count(const uint64_t *hist)
+{
+    uint64_t n = 0;
+
+    for (int b = 0; b < RWLOCK_PROF_NBUCKET; b++)
+        n += hist[b];
+    return n;
+}
+
+/*
+ * 빈 구간을 빼고 "<상한:횟수" 꼴로 한 줄에 출력한다. 마지막 구간은 그 이상을 모두 센다.
+ */
+static void hist_print(FILE *fp, const char *name, const uint64_t *hist)
+{
+    fprintf(fp, "        %s_ns", name);
+    for (int b = 0; b < RWLOCK_PROF_NBUCKET; b++) {
+        if (hist[b] == 0)
+            continue;
+        if (b == RWLOCK_PROF_NBUCKET - 1)
+            fprintf(fp, " >=%llu:%llu", 1ULL << (b - 1), (unsigned long long)hist[b]);
+        else
+            fprintf(fp, " <%llu:%llu", 1ULL << b, (unsigned long long)hist[b]);
+    }
+    fprintf(fp, "\n");
+}
+#endif
+
+/*
+ * 락의 통계를 모든 slot에 걸쳐 합쳐서 fp에 출력한다. 다른 스레드가 락을 쓰는 중에 불러도 되며,
+ * 그때는 출력하는 동안 바뀐 값이 섞일 수 있다. RWLOCK_PROFILE 없이 빌드했으면 아무것도 하지 않는다.
+ */
+void rwlock_prof_dump(rwlock_t *lock, FILE *fp)
+{
+#ifdef RWLOCK_PROFILE
+    static const char *policy_name[] = { "reader_prefer", "writer_prefer", "fair", "bigreader", "phasefair" };
+    static const char *class_name[RWLOCK_PROF_NCLASS] = { "read", "write" };
+    struct rwlock_prof_class sum;
+    const struct rwlock_prof_class *c;
+    uint64_t nwait, nhold;
+
+    fprintf(fp, "rwlock %p (%s)\n", (void *)lock, policy_name[lock->policy]);
+    for (int k = 0; k < RWLOCK_PROF_NCLASS; k++) {
+        memset(&sum, 0, sizeof(sum));
+        for (int i = 0; i < RWLOCK_NSLOT; i++) {
+            c = &lock->prof->slot[i].cls[k];
+            sum.attempts += __atomic_load_n(&c->attempts, __ATOMIC_RELAXED);
+            sum.contended += __atomic_load_n(&c->contended, __ATOMIC_RELAXED);
+            sum.wait_total += __atomic_load_n(&c->wait_total, __ATOMIC_RELAXED);
+            sum.hold_total += __atomic_load_n(&c->hold_total, __ATOMIC_RELAXED);
+            for (int b = 0; b < RWLOCK_PROF_NBUCKET; b++) {
+                sum.wait[b] += __atomic_load_n(&c->wait[b], __ATOMIC_RELAXED);
+                sum.hold[b] += __atomic_load_n(&c->hold[b], __ATOMIC_RELAXED);
+            }
+        }
+        nwait = hist_count(sum.wait);
+        nhold = hist_count(sum.hold);
+        fprintf(fp, "  %-5s attempts %llu contended %llu (%.1f%%) wait_avg %.0fns hold_avg %.0fns\n", class_name[k],
+                (unsigned long long)sum.attempts, (unsigned long long)sum.contended,
+                sum.attempts ? sum.contended * 100.0 / sum.attempts : 0.0,
+                nwait ? (double)sum.wait_total / nwait : 0.0, nhold ? (double)sum.hold_total / nhold : 0.0);
+        hist_print(fp, "wait", sum.wait);
+        hist_print(fp, "hold", sum.hold);
+    }
+    fflush(fp);
+#endif
+}
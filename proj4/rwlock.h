@@ -0,0 +1,131 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by Kim Taehyeon (2019061658 컴퓨터학부 김태현) (26.10.19)
+#ifndef _RWLOCK_H_
+#define _RWLOCK_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#define RWLOCK_READER 0
+#define RWLOCK_WRITER 1
+#define RWLOCK_FAIR 2
+#define RWLOCK_BIGREADER 3
+#define RWLOCK_PHASEFAIR 4
+#define RWLOCK_NSLOT 64
+#define RWLOCK_CACHELINE 64
+#define RWLOCK_SUCCESS 0
+#define RWLOCK_FAIL 1
+#define RWLOCK_BUSY 2
+#define RWLOCK_TIMEOUT 3
+#define RWLOCK_PROF_READ 0
+#define RWLOCK_PROF_WRITE 1
+#define RWLOCK_PROF_NCLASS 2
+#define RWLOCK_PROF_NBUCKET 32
+
+/*
+ * reader_prefer_cond.c, writer_prefer_cond.c, fair_reader_writer_mutex.c의 프로토콜을
+ * 하나로 묶은 reader-writer 락 구조체 타입
+ *
+ * policy는 초기화할 때 정하며 RWLOCK_READER(reader 우선), RWLOCK_WRITER(writer 우선),
+ * RWLOCK_FAIR(도착 순서대로), RWLOCK_BIGREADER(읽기 위주), RWLOCK_PHASEFAIR(reader와 writer가 번갈아) 중 하나이다.
+ * state는 락을 가진 쪽을 나타내는 워드로, 경합이 없으면 이 워드에 대한 CAS 한 번으로 락을 얻고 놓는다.
+ * 가장 아래 비트는 writer가 락을 가졌는지, 그다음 비트는 mutex 아래에서 기다리는 스레드가 있는지를 뜻하고,
+ * 나머지 비트는 락을 가진 reader의 수이다. 기다리는 스레드가 있으면 락을 놓는 쪽이 mutex를 잡고 깨워 준다.
+ * reader_wait과 writer_wait은 기다리는 reader와 writer의 수이며, writer 우선 정책에서 reader는
+ * writer_wait이 0이 아니면 들어가지 않는다. RWLOCK_FAIR는 기다리는 스레드를 도착 순서대로 head부터 줄 세우고
+ * 맨 앞의 스레드만 락을 얻게 해서, 뮤텍스가 줄 세우는 순서에 기대지 않고 도착 순서를 지킨다.
+ *
+ * RWLOCK_BIGREADER는 읽기가 대부분인 경우를 위한 정책으로, reader는 state 대신 스레드마다 정해진
+ * slot의 reader 수만 고친다. slot은 캐시 라인 하나씩을 차지하므로 reader끼리는 같은 라인을 건드리지 않는다.
+ * writer는 state의 writer 비트를 세운 뒤 모든 slot이 0이 될 때까지 기다리고, writer 비트를 본 reader는
+ * slot을 되돌리고 writer가 나갈 때까지 기다린다. 그 대신 writer의 비용은 slot 수에 비례한다.
+ *
+ * RWLOCK_PHASEFAIR는 ticket 카운터 네 개로 만든 phase-fair 락으로 state와 mutex를 쓰지 않는다.
+ * reader는 rin을 한 번 fetch-add 해서 들어오고 나갈 때 rout을 올린다. writer는 win에서 번호표를 뽑아
+ * wout이 자기 번호가 될 때까지 기다린 뒤, rin의 아래 여덟 비트에 세대가 붙은 표시를 하고 그때까지 들어온
+ * reader가 모두 rout을 올리기를 기다린다. 표시를 본 reader는 바로 그 표시가 없어질 때까지만 기다리므로,
+ * writer가 줄을 서 있어도 reader는 writer 하나 뒤에, writer는 reader 한 무리 뒤에 들어가게 되어
+ * 양쪽 모두 기다리는 시간이 제한된다. 기다릴 때는 잠들지 않고 양보하며 돈다.
+ *
+ * rwlock_uplock()으로 얻는 upgrade할 수 있는 읽기 락은 보통 reader와 함께 들어가지만 다른 upgrader나
+ * writer와는 함께 들어가지 않으며, rwlock_upgrade()로 락을 놓지 않고 쓰기 락으로 바꿀 수 있다.
+ * upgrade_mutex는 upgrader를 하나로 제한하고, upgrade를 기다리는 upgrader는 upgrade_cond에서 기다린다.
+ * 반대로 writer는 rwlock_downgrade()로 락을 놓지 않고 읽기 락으로 바꿀 수 있다.
+ *
+ * try 함수는 기다려야 하면 곧바로 RWLOCK_BUSY를, timed 함수는 pthread_rwlock_timedwrlock()처럼
+ * CLOCK_REALTIME 기준의 절대 시각 abstime까지 얻지 못하면 RWLOCK_TIMEOUT을 돌려준다. 기한이 지난 스레드는
+ * 대기 수와 RWLOCK_FAIR의 줄에서 자기를 빼고, 자기 때문에 막혀 있던 스레드를 깨운 뒤 나간다.
+ * RWLOCK_PHASEFAIR의 try와 timed 함수는 물릴 수 없는 번호표를 뽑지 않고 writer가 없을 때만 들어가며,
+ * 쓰기는 안에 reader도 없을 때만 표시하므로 phase-fair한 순서를 보장받지 못한다.
+ *
+ * -DRWLOCK_PROFILE로 빌드하면 락마다 읽기와 쓰기를 나눠 시도 횟수, 경합 횟수, 기다린 시간과
+ * 가지고 있던 시간의 히스토그램을 스레드별로 모은다. rwlock_prof_dump()로 언제든 출력할 수 있고,
+ * rwlock_destroy()와 프로그램이 끝날 때 살아 있는 락의 통계를 stderr로 출력한다.
+ *
+ * rwlock_combine()은 flat combining으로 쓰기를 한다. writer는 쓰기 락을 직접 얻는 대신 할 일을
+ * fc_list에 올리고, fc_busy를 얻은 writer 하나(combiner)가 쓰기 락을 한 번 얻어 올라온 일을 모두 해 준 뒤 놓는다.
+ * 나머지 writer는 자기 일이 끝나거나 combiner가 없어질 때까지 양보하며 돈다. writer가 몰릴 때
+ * 락을 넘겨주는 횟수가 줄고, 보호하는 데이터가 combiner의 캐시에 머무른다.
+ */
+struct rwlock_prof;
+struct rwlock_fc;
+
+struct rwlock_waiter {
+    struct rwlock_waiter *next;
+};
+
+struct rwlock_slot {
+    _Alignas(RWLOCK_CACHELINE) _Atomic long readers;
+};
+
+typedef struct {
+    _Atomic uint32_t state;         /* writer 비트, 대기 비트, reader 수 */
+    int policy;                     /* RWLOCK_READER, RWLOCK_WRITER, RWLOCK_FAIR, RWLOCK_BIGREADER, RWLOCK_PHASEFAIR */
+    pthread_mutex_t mutex;          /* 느린 경로의 대기 정보를 보호하는 상호배타 락 */
+    pthread_cond_t reader_cond;     /* reader가 기다리는 곳 */
+    pthread_cond_t writer_cond;     /* writer가 기다리는 곳 */
+    int reader_wait;                /* 기다리는 reader의 수 */
+    int writer_wait;                /* 기다리는 writer의 수 */
+    int upgrade_wait;               /* 다른 reader가 나가기를 기다리는 upgrader의 수 */
+    pthread_mutex_t upgrade_mutex;  /* upgrader를 하나로 제한하는 락, RWLOCK_BIGREADER에서는 writer도 잡음 */
+    pthread_cond_t upgrade_cond;    /* upgrader가 upgrade를 기다리는 곳 */
+    struct rwlock_waiter *head;     /* RWLOCK_FAIR에서 기다리는 스레드 줄의 맨 앞 */
+    struct rwlock_waiter *tail;     /* RWLOCK_FAIR에서 기다리는 스레드 줄의 맨 뒤 */
+    struct rwlock_slot *slot;       /* RWLOCK_BIGREADER의 reader slot 배열, 그 밖의 정책은 NULL */
+    _Atomic uint32_t rin;           /* RWLOCK_PHASEFAIR에서 들어온 reader 수와 writer 표시 */
+    _Atomic uint32_t rout;          /* RWLOCK_PHASEFAIR에서 나간 reader 수 */
+    _Atomic uint32_t win;           /* RWLOCK_PHASEFAIR에서 writer에게 나눠 준 번호표 */
+    _Atomic uint32_t wout;          /* RWLOCK_PHASEFAIR에서 락을 얻을 차례인 writer 번호표 */
+    uint32_t wmark;                 /* RWLOCK_PHASEFAIR에서 마지막으로 한 writer 표시, 차례인 writer만 고침 */
+    struct rwlock_prof *prof;       /* RWLOCK_PROFILE로 빌드했을 때의 통계, 그렇지 않으면 NULL */
+    _Atomic(struct rwlock_fc *) fc_list;    /* rwlock_combine()으로 올라온 일의 publication list */
+    atomic_bool fc_busy;            /* 올라온 일을 해 주는 combiner가 있는지 */
+} rwlock_t;
+
+int rwlock_init(rwlock_t *lock, int policy);
+int rwlock_destroy(rwlock_t *lock);
+int rwlock_rdlock(rwlock_t *lock);
+int rwlock_rdunlock(rwlock_t *lock);
+int rwlock_wrlock(rwlock_t *lock);
+int rwlock_wrunlock(rwlock_t *lock);
+int rwlock_tryrdlock(rwlock_t *lock);
+int rwlock_trywrlock(rwlock_t *lock);
+int rwlock_timedrdlock(rwlock_t *lock, const struct timespec *abstime);
+int rwlock_timedwrlock(rwlock_t *lock, const struct timespec *abstime);
+int rwlock_uplock(rwlock_t *lock);
+int rwlock_upunlock(rwlock_t *lock);
+int rwlock_upgrade(rwlock_t *lock);
+int rwlock_downgrade(rwlock_t *lock);
+int rwlock_combine(rwlock_t *lock, void (*op)(void *), void *arg);
+void rwlock_prof_dump(rwlock_t *lock, FILE *fp);
+
+#endif
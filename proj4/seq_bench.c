@@ -0,0 +1,251 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by Kim Taehyeon (2019061658 컴퓨터학부 김태현) (26.10.19)
+
+/*
+ * 작은 공유 구조체를 seqlock, RCU와 기존 방식들로 보호했을 때의 처리량을 비교하는 벤치마크이다.
+ * reader는 구조체를 쉬지 않고 복사해서 검사하고, writer는 원래 프로그램처럼 SLEEPTIME 나노초 안에서
+ * 랜덤하게 쉬어 가며 구조체를 고친다. NREAD/NWRITE 조합과 방식마다 CSV 한 줄을 출력한다.
+ * torn은 reader가 일관되지 않은 구조체를 본 횟수로, 모든 방식에서 0이어야 한다.
+ * RCU에서 writer는 새 구조체를 만들어 포인터를 바꾸고, reader는 읽을 때마다 quiescent 상태를 알린다.
+ * -s를 주면 reader 수를 1부터 두 배씩 늘려 가며 돌려서 코어 수에 따라 읽기 처리량이 느는지 본다.
+ *
+ * 사용법: seq_bench [-r reader수] [-w writer수] [-t 실행시간(ms)] [-s]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "rwlock.h"
+#include "seqlock.h"
+#include "rcu.h"
+
+#define NREAD 20
+#define NWRITE 5
+#define RUNTIME 200
+#define SLEEPTIME 100000
+
+/*
+ * 보호하는 구조체이다. writer는 모든 필드를 같은 값으로 바꾸고, sum을 그 합으로 맞춘다.
+ */
+typedef struct {
+    uint64_t a, b, c, d;
+    uint64_t sum;
+} config_t;
+
+enum { MUTEX, READER_COND, WRITER_COND, FAIR, SEQLOCK, RCU, NMETHOD };
+static const char *method_name[NMETHOD] = { "mutex", "reader_prefer", "writer_prefer", "fair", "seqlock", "rcu" };
+
+static int method;
+static atomic_bool alive;
+static config_t shared;
+static pthread_mutex_t mutex;
+static rwlock_t rwlock;
+static seqlock_t seqlock;
+static rcu_t rcu;
+static config_t *rcu_shared;
+static __thread rcu_reader_t *rcu_self;
+
+typedef struct {
+    pthread_t tid;
+    unsigned long ops;
+    unsigned long torn;
+} worker_t;
+
+static void read_config(config_t *c)
+{
+    unsigned s;
+
+    switch (method) {
+        case MUTEX:
+            pthread_mutex_lock(&mutex);
+            *c = shared;
+            pthread_mutex_unlock(&mutex);
+            break;
+        case SEQLOCK:
+            do {
+                s = seqlock_read_begin(&seqlock);
+                seqlock_read(c, &shared, sizeof(*c));
+            } while (seqlock_read_retry(&seqlock, s));
+            break;
+        case RCU:
+            *c = *rcu_dereference(rcu_shared);
+            rcu_quiescent(rcu_self);
+            break;
+        default:
+            rwlock_rdlock(&rwlock);
+            *c = shared;
+            rwlock_rdunlock(&rwlock);
+    }
+}
+
+static void write_config(const config_t *c)
+{
+    config_t *fresh, *old;
+
+    switch (method) {
+        case MUTEX:
+            pthread_mutex_lock(&mutex);
+            shared = *c;
+            pthread_mutex_unlock(&mutex);
+            break;
+        case SEQLOCK:
+            seqlock_write_lock(&seqlock);
+            seqlock_write(&shared, c, sizeof(*c));
+            seqlock_write_unlock(&seqlock);
+            break;
+        case RCU:
+            fresh = (config_t *)malloc(sizeof(config_t));
+            *fresh = *c;
+            old = __atomic_exchange_n(&rcu_shared, fresh, __ATOMIC_ACQ_REL);
+            rcu_retire(&rcu, old, free);
+            break;
+        default:
+            rwlock_wrlock(&rwlock);
+            shared = *c;
+            rwlock_wrunlock(&rwlock);
+    }
+}
+
+static void *reader(void *arg)
+{
+    worker_t *w = (worker_t *)arg;
+    config_t c;
+
+    if (method == RCU)
+        rcu_self = rcu_register(&rcu);
+    while (alive) {
+        read_config(&c);
+        if (c.a != c.b || c.b != c.c || c.c != c.d || c.sum != c.a * 4)
+            w->torn++;
+        w->ops++;
+    }
+    if (method == RCU)
+        rcu_unregister(rcu_self);
+    return NULL;
+}
+
+static void *writer(void *arg)
+{
+    worker_t *w = (worker_t *)arg;
+    unsigned seed = (unsigned)(uintptr_t)arg;
+    struct timespec req;
+    config_t c;
+
+    while (alive) {
+        c.a = c.b = c.c = c.d = rand_r(&seed);
+        c.sum = c.a * 4;
+        write_config(&c);
+        w->ops++;
+        req.tv_sec = 0;
+        req.tv_nsec = rand_r(&seed) % SLEEPTIME;
+        nanosleep(&req, NULL);
+    }
+    return NULL;
+}
+
+/*
+ * nread개의 reader와 nwrite개의 writer를 runtime 밀리초 동안 돌리고 결과를 한 줄 출력한다.
+ */
+static void run(int nread, int nwrite, int runtime)
+{
+    worker_t r[nread], w[nwrite];
+    unsigned long rops = 0, wops = 0, torn = 0;
+    struct timespec req;
+
+    switch (method) {
+        case MUTEX: pthread_mutex_init(&mutex, NULL); break;
+        case READER_COND: rwlock_init(&rwlock, RWLOCK_READER); break;
+        case WRITER_COND: rwlock_init(&rwlock, RWLOCK_WRITER); break;
+        case FAIR: rwlock_init(&rwlock, RWLOCK_FAIR); break;
+        case SEQLOCK: seqlock_init(&seqlock); break;
+        case RCU:
+            rcu_init(&rcu);
+            rcu_shared = (config_t *)calloc(1, sizeof(config_t));
+            break;
+    }
+    shared = (config_t){ 0, 0, 0, 0, 0 };
+    alive = true;
+    for (int i = 0; i < nread; i++) {
+        r[i].ops = r[i].torn = 0;
+        pthread_create(&r[i].tid, NULL, reader, r + i);
+    }
+    for (int i = 0; i < nwrite; i++) {
+        w[i].ops = w[i].torn = 0;
+        pthread_create(&w[i].tid, NULL, writer, w + i);
+    }
+    req.tv_sec = runtime / 1000;
+    req.tv_nsec = (runtime % 1000) * 1000000L;
+    nanosleep(&req, NULL);
+    alive = false;
+    for (int i = 0; i < nread; i++) {
+        pthread_join(r[i].tid, NULL);
+        rops += r[i].ops;
+        torn += r[i].torn;
+    }
+    for (int i = 0; i < nwrite; i++) {
+        pthread_join(w[i].tid, NULL);
+        wops += w[i].ops;
+    }
+    switch (method) {
+        case MUTEX: pthread_mutex_destroy(&mutex); break;
+        case SEQLOCK: seqlock_destroy(&seqlock); break;
+        case RCU:
+            rcu_destroy(&rcu);
+            free(rcu_shared);
+            break;
+        default: rwlock_destroy(&rwlock);
+    }
+    printf("%s,%d,%d,%d,%lu,%.0f,%lu,%.0f,%lu\n", method_name[method], nread, nwrite, runtime,
+           rops, rops * 1000.0 / runtime, wops, wops * 1000.0 / runtime, torn);
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    int nread = NREAD, nwrite = NWRITE, runtime = RUNTIME, opt;
+    bool sweep = false;
+
+    while ((opt = getopt(argc, argv, "r:w:t:s")) != -1) {
+        switch (opt) {
+            case 'r': nread = atoi(optarg); break;
+            case 'w': nwrite = atoi(optarg); break;
+            case 't': runtime = atoi(optarg); break;
+            case 's': sweep = true; break;
+            default:
+                fprintf(stderr, "usage: %s [-r readers] [-w writers] [-t runtime_ms] [-s]\n", argv[0]);
+                return 1;
+        }
+    }
+    if (nread < 1 || nwrite < 1 || runtime < 1) {
+        fprintf(stderr, "usage: %s [-r readers] [-w writers] [-t runtime_ms] [-s]\n", argv[0]);
+        return 1;
+    }
+
+    /*
+     * 원래 프로그램의 NREAD:NWRITE 비율과, writer를 하나로 줄인 경우를 돌린다.
+     */
+    printf("method,readers,writers,runtime_ms,reads,reads_per_sec,writes,writes_per_sec,torn\n");
+    if (sweep) {
+        for (int n = 1; n <= nread; n *= 2)
+            for (method = 0; method < NMETHOD; method++)
+                run(n, nwrite, runtime);
+        return 0;
+    }
+    for (int k = 0; k < 2; k++) {
+        int nw = k == 0 ? nwrite : 1;
+        if (k == 1 && nwrite == 1)
+            break;
+        for (method = 0; method < NMETHOD; method++)
+            run(nread, nw, runtime);
+    }
+    return 0;
+}
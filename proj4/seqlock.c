@@ -0,0 +1,101 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by Kim Taehyeon (2019061658 컴퓨터학부 김태현) (26.10.19)
+#include <sched.h>
+#include <stdint.h>
+#include "seqlock.h"
+
+int seqlock_init(seqlock_t *lock)
+{
+    atomic_init(&lock->seq, 0);
+    if (pthread_mutex_init(&lock->mutex, NULL) != 0)
+        return SEQLOCK_FAIL;
+    return SEQLOCK_SUCCESS;
+}
+
+int seqlock_destroy(seqlock_t *lock)
+{
+    if (atomic_load(&lock->seq) & 1)
+        return SEQLOCK_FAIL;
+    pthread_mutex_destroy(&lock->mutex);
+    return SEQLOCK_SUCCESS;
+}
+
+/*
+ * 읽기를 시작한다. writer가 쓰는 중이면 끝날 때까지 양보하며 기다린 뒤 짝수인 seq를 돌려준다.
+ */
+unsigned seqlock_read_begin(seqlock_t *lock)
+{
+    unsigned s;
+
+    while ((s = atomic_load_explicit(&lock->seq, memory_order_acquire)) & 1)
+        sched_yield();
+    return s;
+}
+
+/*
+ * 읽기를 끝낸다. seq가 그대로이면 거짓을, 그사이 writer가 다녀갔으면 참을 돌려준다.
+ * 데이터를 acquire로 읽었으므로 여기서 seq를 다시 읽는 것이 데이터 읽기보다 앞당겨지지 않는다.
+ */
+bool seqlock_read_retry(seqlock_t *lock, unsigned seq)
+{
+    return atomic_load_explicit(&lock->seq, memory_order_relaxed) != seq;
+}
+
+/*
+ * 보호하는 데이터를 읽는다. 정렬된 부분은 8바이트씩, 나머지는 1바이트씩 acquire로 읽는다.
+ * writer가 데이터를 release로 쓰므로 새 값을 하나라도 읽었다면 seq가 바뀐 것도 보이게 된다.
+ */
+void seqlock_read(void *dst, const void *src, size_t len)
+{
+    unsigned char *d = (unsigned char *)dst;
+    const unsigned char *s = (const unsigned char *)src;
+    size_t i = 0;
+
+    if (((uintptr_t)d | (uintptr_t)s) % sizeof(uint64_t) == 0)
+        for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t))
+            *(uint64_t *)(d + i) = __atomic_load_n((const uint64_t *)(s + i), __ATOMIC_ACQUIRE);
+    for (; i < len; i++)
+        d[i] = __atomic_load_n(s + i, __ATOMIC_ACQUIRE);
+}
+
+/*
+ * 쓰기를 시작한다. 다른 writer를 배제한 뒤 seq를 홀수로 만든다.
+ */
+void seqlock_write_lock(seqlock_t *lock)
+{
+    pthread_mutex_lock(&lock->mutex);
+    atomic_store_explicit(&lock->seq, atomic_load_explicit(&lock->seq, memory_order_relaxed) + 1,
+                          memory_order_relaxed);
+}
+
+/*
+ * 쓰기를 끝낸다. seq를 다시 짝수로 만들고 다른 writer에게 넘긴다.
+ */
+void seqlock_write_unlock(seqlock_t *lock)
+{
+    atomic_store_explicit(&lock->seq, atomic_load_explicit(&lock->seq, memory_order_relaxed) + 1,
+                          memory_order_release);
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+/*
+ * seqlock_write_lock()과 seqlock_write_unlock() 사이에서 보호하는 데이터를 쓴다.
+ * release로 쓰므로 이 값을 읽은 reader에게는 앞서 홀수로 바꾼 seq도 보인다.
+ */
+void seqlock_write(void *dst, const void *src, size_t len)
+{
+    unsigned char *d = (unsigned char *)dst;
+    const unsigned char *s = (const unsigned char *)src;
+    size_t i = 0;
+
+    if (((uintptr_t)d | (uintptr_t)s) % sizeof(uint64_t) == 0)
+        for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t))
+            __atomic_store_n((uint64_t *)(d + i), *(const uint64_t *)(s + i), __ATOMIC_RELEASE);
+    for (; i < len; i++)
+        __atomic_store_n(d + i, s[i], __ATOMIC_RELEASE);
+}
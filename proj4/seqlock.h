@@ -0,0 +1,43 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by Kim Taehyeon (2019061658 컴퓨터학부 김태현) (26.10.19)
+#ifndef _SEQLOCK_H_
+#define _SEQLOCK_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define SEQLOCK_SUCCESS 0
+#define SEQLOCK_FAIL 1
+
+/*
+ * 작은 공유 구조체를 위한 seqlock 구조체 타입
+ *
+ * reader는 공유 메모리에 아무것도 쓰지 않는다. seqlock_read_begin()으로 seq를 읽어 두고 데이터를 복사한 뒤,
+ * seqlock_read_retry()가 참이면 그동안 writer가 다녀간 것이므로 처음부터 다시 읽는다.
+ * writer끼리는 mutex로 배타적이며, 쓰는 동안 seq를 홀수로 만들었다가 다 쓰면 다시 짝수로 만든다.
+ * 보호하는 데이터는 seqlock_read()와 seqlock_write()로 복사해야 한다. 두 함수는 워드 단위 원자적
+ * 읽기와 쓰기로 복사하므로 reader가 쓰는 중인 데이터를 읽더라도 데이터 경쟁이 되지 않는다.
+ * 읽은 값은 seqlock_read_retry()가 거짓일 때만 믿을 수 있고, 포인터를 따라가면 안 된다.
+ */
+typedef struct {
+    _Atomic unsigned seq;           /* 짝수면 쓰는 writer가 없고, 홀수면 쓰는 중 */
+    pthread_mutex_t mutex;          /* writer끼리의 상호배타 락 */
+} seqlock_t;
+
+int seqlock_init(seqlock_t *lock);
+int seqlock_destroy(seqlock_t *lock);
+unsigned seqlock_read_begin(seqlock_t *lock);
+bool seqlock_read_retry(seqlock_t *lock, unsigned seq);
+void seqlock_read(void *dst, const void *src, size_t len);
+void seqlock_write_lock(seqlock_t *lock);
+void seqlock_write_unlock(seqlock_t *lock);
+void seqlock_write(void *dst, const void *src, size_t len);
+
+#endif
@@ -56,7 +56,7 @@ void number3(void *param)
  */
 void dot(void *param)
 {
-    if ((rand() % 16384) == 0) {
+    if ((pthread_pool_rand() % 16384) == 0) {
         printf(".");
         fflush(stdout);
     }
@@ -0,0 +1,127 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by DevTae (2019061658 컴퓨터학부 김태현) (26.10.19)
+
+/*
+ * pthread_pool_t의 필드 배치에 따른 경합을 재는 마이크로벤치마크이다.
+ * 같은 소스를 캐시 라인에 맞춘 배치(layout_bench)와 POOL_PACKED_LAYOUT으로 맞추지 않은
+ * 배치(layout_bench_packed)로 두 번 빌드해서 결과를 비교한다.
+ * 빈 작업을 작은 대기열에 POOL_WAIT로 넣어서 요청하는 쪽과 일꾼이 모두 제어블록을 계속 건드리게 하고,
+ * bee_size와 요청 스레드 수를 늘려 가며 처리량을 CSV로 출력한다. 각 조합은 여러 번 돌려 가장 좋은 값을 쓴다.
+ *
+ * 사용법: layout_bench [-n 작업수] [-p 최대_producer수] [-b 최대_bee_size] [-r 반복수]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include "pthread_pool.h"
+
+#ifdef POOL_PACKED_LAYOUT
+#define LAYOUT "packed"
+#else
+#define LAYOUT "aligned"
+#endif
+
+#define QUEUE_SIZE 64
+
+typedef struct {
+    pthread_pool_t *pool;
+    int count;
+} producer_t;
+
+static atomic_long done;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void empty(void *param)
+{
+    atomic_fetch_add_explicit(&done, 1, memory_order_relaxed);
+}
+
+static void *producer(void *param)
+{
+    producer_t *p = (producer_t *)param;
+
+    for (int i = 0; i < p->count; i++)
+        pthread_pool_submit(p->pool, empty, NULL, POOL_WAIT);
+    return NULL;
+}
+
+/*
+ * 새 스레드풀을 만들어 tasks개의 빈 작업을 nprod개의 스레드로 나눠 넣고, 모두 끝날 때까지 걸린 시간을 돌려준다.
+ */
+static double run(int nprod, int bee_size, int tasks)
+{
+    pthread_pool_t pool;
+    pthread_t tid[nprod];
+    producer_t arg[nprod];
+
+    if (pthread_pool_init(&pool, bee_size, QUEUE_SIZE) != POOL_SUCCESS) {
+        fprintf(stderr, "pthread_pool_init(%d, %d) failed\n", bee_size, QUEUE_SIZE);
+        exit(1);
+    }
+    atomic_store(&done, 0);
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < nprod; i++) {
+        arg[i].pool = &pool;
+        arg[i].count = tasks / nprod + (i < tasks % nprod);
+        pthread_create(tid + i, NULL, producer, arg + i);
+    }
+    for (int i = 0; i < nprod; i++)
+        pthread_join(tid[i], NULL);
+    pthread_pool_shutdown(&pool, POOL_COMPLETE);
+    uint64_t t1 = now_ns();
+    if (atomic_load(&done) != tasks) {
+        fprintf(stderr, "lost tasks: %ld/%d\n", atomic_load(&done), tasks);
+        exit(1);
+    }
+    return (t1 - t0) / 1e9;
+}
+
+int main(int argc, char *argv[])
+{
+    int tasks = 200000, max_prod = 8, max_bee = 64, repeat = 3, opt;
+
+    while ((opt = getopt(argc, argv, "n:p:b:r:")) != -1) {
+        switch (opt) {
+        case 'n': tasks = atoi(optarg); break;
+        case 'p': max_prod = atoi(optarg); break;
+        case 'b': max_bee = atoi(optarg); break;
+        case 'r': repeat = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-n tasks] [-p producers] [-b bees] [-r repeat]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (tasks < 1 || max_prod < 1 || max_bee < 1 || repeat < 1) {
+        fprintf(stderr, "usage: %s [-n tasks] [-p producers] [-b bees] [-r repeat]\n", argv[0]);
+        return 1;
+    }
+
+    printf("layout,sizeof,producers,bee_size,queue_size,tasks,seconds,throughput,ns_per_task\n");
+    for (int b = 1; b <= max_bee; b *= 4) {
+        for (int p = 1; p <= max_prod; p *= 2) {
+            double best = 0;
+            for (int r = 0; r < repeat; r++) {
+                double s = run(p, b, tasks);
+                if (r == 0 || s < best)
+                    best = s;
+            }
+            printf("%s,%zu,%d,%d,%d,%d,%.4f,%.0f,%.1f\n", LAYOUT, sizeof(pthread_pool_t), p, b, QUEUE_SIZE,
+                   tasks, best, tasks / best, best * 1e9 / tasks);
+            fflush(stdout);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,448 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by DevTae (Kim Taehyeon / 컴퓨터학과 / 3학년 2019061658)
+
+#include "pool_aio.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+// io_uring 헤더가 있는 리눅스에서만 io_uring 을 씀, liburing 없이 시스템 호출을 직접 부름 (26.10.19)
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define HAVE_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+#endif
+
+#define OP_READ 0
+#define OP_WRITE 1
+
+/*
+ * 맡겨진 입출력 요청 하나이다. 입출력이 끝나면 res에 옮긴 바이트 수나 -errno가 담기고,
+ * 스레드풀의 작업으로 cb(arg, res)가 불린다. next는 POOL_AIO_THREAD의 요청 대기열에서 쓴다.
+ */
+struct pool_aio_req {
+    pool_aio_t *aio;
+    void (*cb)(void *arg, ssize_t res);
+    void *arg;
+    ssize_t res;
+    int op;
+    int fd;
+    void *buf;
+    size_t len;
+    off_t off;
+    struct pool_aio_req *next;
+};
+
+/*
+ * 스레드풀의 일꾼이 실행하는 후속 작업이다. 사용자의 후속 함수를 부르고 요청을 반납한다.
+ * 후속 함수 안에서 다시 요청하면 pending이 먼저 늘어나므로 pool_aio_shutdown()이 그 사이에 끝나지 않는다.
+ */
+static void complete(void *param)
+{
+    struct pool_aio_req *req = (struct pool_aio_req *)param;
+    pool_aio_t *aio = req->aio;
+
+    (*(req->cb))(req->arg, req->res);
+    free(req);
+
+    pthread_mutex_lock(&(aio->mutex));
+    if (--aio->pending == 0)
+        pthread_cond_broadcast(&(aio->idle));
+    pthread_mutex_unlock(&(aio->mutex));
+}
+
+/*
+ * 입출력이 끝난 요청 req의 자리를 돌려주고 후속 작업을 스레드풀에 요청한다.
+ * 자리를 먼저 돌려주므로 스레드풀의 대기열이 꽉 차서 기다리는 동안에도 다른 요청이 들어올 수 있다.
+ * 스레드풀이 이미 종료되었으면 이 스레드에서 후속 함수를 바로 부른다.
+ */
+static void finish(struct pool_aio_req *req, ssize_t res)
+{
+    pool_aio_t *aio = req->aio;
+
+    req->res = res;
+    pthread_mutex_lock(&(aio->mutex));
+    aio->inflight--;
+    pthread_cond_signal(&(aio->space));
+    pthread_mutex_unlock(&(aio->mutex));
+
+    if (pthread_pool_submit(aio->pool, complete, req, POOL_WAIT) != POOL_SUCCESS)
+        complete(req);
+}
+
+/*
+ * POOL_AIO_THREAD의 입출력 스레드가 수행할 함수이다.
+ * 요청 대기열에서 요청을 하나씩 꺼내 pread()나 pwrite()를 부른다. 종료 중이고 대기열이 비면 끝난다.
+ */
+static void *io_thread(void *param)
+{
+    pool_aio_t *aio = (pool_aio_t *)param;
+
+    while (true) {
+        pthread_mutex_lock(&(aio->mutex));
+        while (aio->head == NULL && aio->running)
+            pthread_cond_wait(&(aio->work), &(aio->mutex));
+        struct pool_aio_req *req = aio->head;
+        if (req == NULL) {
+            pthread_mutex_unlock(&(aio->mutex));
+            return NULL;
+        }
+        if ((aio->head = req->next) == NULL)
+            aio->tail = NULL;
+        pthread_mutex_unlock(&(aio->mutex));
+
+        ssize_t res;
+        do {
+            res = req->op == OP_READ ? pread(req->fd, req->buf, req->len, req->off)
+                                     : pwrite(req->fd, req->buf, req->len, req->off);
+        } while (res < 0 && errno == EINTR);
+        finish(req, res < 0 ? -errno : res);
+    }
+}
+
+#ifdef HAVE_URING
+static int uring_enter(int fd, unsigned submit, unsigned min_complete, unsigned flags)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, submit, min_complete, flags, NULL, 0);
+}
+
+/*
+ * 시그널이 아닌 이유로 io_uring_enter()가 실패했을 때 잠시 쉰다.
+ * 자원이 모자란 실패는 조금 뒤에 풀리고, 풀리지 않는 실패라도 CPU를 다 쓰며 돌지 않게 한다.
+ */
+static void uring_backoff(void)
+{
+    struct timespec ts = { 0, 1000000 };
+
+    nanosleep(&ts, NULL);
+}
+
+/*
+ * 제출 큐에 요청 하나를 넣고 커널에 알린다. user_data가 0이면 완료 스레드를 끝내는 NOP이다.
+ * mutex를 쥐고 불러야 하며, inflight가 depth를 넘지 않으므로 제출 큐에는 늘 자리가 있다.
+ * 커널이 받아 가면 0을, 받지 못하면 넣은 항목을 도로 빼고 -errno를 리턴한다.
+ */
+static int uring_push(pool_aio_t *aio, struct pool_aio_req *req)
+{
+    unsigned tail = *aio->sq_tail;
+    unsigned idx = tail & *aio->sq_mask;
+    struct io_uring_sqe *sqe = (struct io_uring_sqe *)aio->sqes + idx;
+
+    memset(sqe, 0, sizeof(*sqe));
+    if (req == NULL) {
+        sqe->opcode = IORING_OP_NOP;
+    } else {
+        sqe->opcode = req->op == OP_READ ? IORING_OP_READ : IORING_OP_WRITE;
+        sqe->fd = req->fd;
+        sqe->addr = (uintptr_t)req->buf;
+        sqe->len = req->len;
+        sqe->off = req->off;
+        sqe->user_data = (uintptr_t)req;
+    }
+    aio->sq_array[idx] = idx;
+    __atomic_store_n(aio->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    // 시그널로 끊기면 다시 부름 (26.10.19)
+    int n;
+    while ((n = uring_enter(aio->ring_fd, 1, 0, 0)) < 0 && errno == EINTR)
+        ;
+    if (n == 1)
+        return 0;
+    // 실패하면 커널이 아무것도 가져가지 않았으므로 꼬리를 되돌려 항목을 빼냄, 남겨 두면 제출되지 않은 채 묶임 (26.10.19)
+    int err = n < 0 ? errno : EAGAIN;
+    __atomic_store_n(aio->sq_tail, tail, __ATOMIC_RELEASE);
+    return -err;
+}
+
+/*
+ * POOL_AIO_URING의 완료 스레드가 수행할 함수이다.
+ * 완료 큐에 항목이 생길 때까지 커널에서 기다렸다가 하나씩 거둬서 finish()에 넘긴다.
+ * pool_aio_shutdown()이 넣은 NOP의 완료를 받으면 끝난다.
+ */
+static void *reaper(void *param)
+{
+    pool_aio_t *aio = (pool_aio_t *)param;
+
+    while (true) {
+        unsigned head = *aio->cq_head;
+        if (head == __atomic_load_n(aio->cq_tail, __ATOMIC_ACQUIRE)) {
+            if (uring_enter(aio->ring_fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+                uring_backoff();
+            continue;
+        }
+        struct io_uring_cqe *cqe = (struct io_uring_cqe *)aio->cqes + (head & *aio->cq_mask);
+        struct pool_aio_req *req = (struct pool_aio_req *)(uintptr_t)cqe->user_data;
+        ssize_t res = cqe->res;
+        __atomic_store_n(aio->cq_head, head + 1, __ATOMIC_RELEASE);
+
+        if (req == NULL)
+            return NULL;
+        finish(req, res);
+    }
+}
+
+/*
+ * io_uring fd가 읽기와 쓰기 연산을 지원하는지 커널에 물어본다.
+ * IORING_OP_READ/WRITE와 IORING_REGISTER_PROBE는 5.6 커널부터 있으므로 그 전 커널에서는 false이다.
+ */
+static bool uring_probe(int fd)
+{
+    size_t size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe *probe = (struct io_uring_probe *)calloc(1, size);
+    bool ok = false;
+
+    if (probe != NULL && syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, 256) == 0)
+        ok = probe->last_op >= IORING_OP_WRITE &&
+             (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) &&
+             (probe->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED);
+    free(probe);
+    return ok;
+}
+
+/*
+ * depth 크기의 io_uring을 만들고 제출 큐와 완료 큐를 매핑한다. 성공하면 POOL_SUCCESS를 리턴한다.
+ * 커널이 io_uring을 지원하지 않거나 막혀 있거나 읽기와 쓰기 연산이 없으면 POOL_FAIL을 리턴하고 아무것도 남기지 않는다.
+ */
+static int uring_init(pool_aio_t *aio, unsigned depth)
+{
+    struct io_uring_params p;
+
+    memset(&p, 0, sizeof(p));
+    if ((aio->ring_fd = (int)syscall(__NR_io_uring_setup, depth, &p)) < 0)
+        return POOL_FAIL;
+    // setup만 되고 연산이 없는 옛 커널이면 요청마다 -EINVAL이 되므로 입출력 스레드로 바꾸게 함 (26.10.19)
+    if (!uring_probe(aio->ring_fd)) {
+        close(aio->ring_fd);
+        return POOL_FAIL;
+    }
+
+    aio->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    aio->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    // 한 번에 매핑할 수 있는 커널이면 두 큐를 한 영역으로 매핑함
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (aio->cq_len > aio->sq_len)
+            aio->sq_len = aio->cq_len;
+        aio->cq_len = 0;
+    }
+    aio->sq_ptr = mmap(NULL, aio->sq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, aio->ring_fd, IORING_OFF_SQ_RING);
+    aio->cq_ptr = aio->sq_ptr;
+    if (aio->cq_len > 0 && aio->sq_ptr != MAP_FAILED)
+        aio->cq_ptr = mmap(NULL, aio->cq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, aio->ring_fd, IORING_OFF_CQ_RING);
+    aio->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+    aio->sqes = mmap(NULL, aio->sqes_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, aio->ring_fd, IORING_OFF_SQES);
+    if (aio->sq_ptr == MAP_FAILED || aio->cq_ptr == MAP_FAILED || aio->sqes == MAP_FAILED) {
+        if (aio->sqes != MAP_FAILED)
+            munmap(aio->sqes, aio->sqes_len);
+        if (aio->cq_len > 0 && aio->cq_ptr != MAP_FAILED)
+            munmap(aio->cq_ptr, aio->cq_len);
+        if (aio->sq_ptr != MAP_FAILED)
+            munmap(aio->sq_ptr, aio->sq_len);
+        close(aio->ring_fd);
+        return POOL_FAIL;
+    }
+
+    char *sq = (char *)aio->sq_ptr, *cq = (char *)aio->cq_ptr;
+    aio->sq_tail = (unsigned *)(sq + p.sq_off.tail);
+    aio->sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+    aio->sq_array = (unsigned *)(sq + p.sq_off.array);
+    aio->cq_head = (unsigned *)(cq + p.cq_off.head);
+    aio->cq_tail = (unsigned *)(cq + p.cq_off.tail);
+    aio->cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+    aio->cqes = cq + p.cq_off.cqes;
+    return POOL_SUCCESS;
+}
+
+static void uring_close(pool_aio_t *aio)
+{
+    munmap(aio->sqes, aio->sqes_len);
+    if (aio->cq_len > 0)
+        munmap(aio->cq_ptr, aio->cq_len);
+    munmap(aio->sq_ptr, aio->sq_len);
+    close(aio->ring_fd);
+}
+#endif
+
+/*
+ * 스레드풀 pool과 붙여 쓰는 비동기 파일 입출력을 준비한다. depth는 동시에 맡길 수 있는 요청의 수이다.
+ * backend가 POOL_AIO_AUTO이면 io_uring을 먼저 시도하고 안 되면 입출력 스레드로 바꾸며,
+ * POOL_AIO_THREAD이면 입출력 스레드만 쓴다. 성공하면 POOL_SUCCESS를, 실패하면 POOL_FAIL을 리턴한다.
+ */
+int pool_aio_init(pool_aio_t *aio, pthread_pool_t *pool, unsigned depth, int backend)
+{
+    if (depth < 1 || depth > POOL_AIO_MAXDEPTH || (pool->mode & POOL_PROC))
+        return POOL_FAIL;
+
+    aio->pool = pool;
+    aio->depth = depth;
+    aio->inflight = 0;
+    aio->pending = 0;
+    aio->running = true;
+    aio->head = aio->tail = NULL;
+    aio->nthread = 0;
+    aio->backend = POOL_AIO_THREAD;
+    pthread_mutex_init(&(aio->mutex), NULL);
+    pthread_cond_init(&(aio->space), NULL);
+    pthread_cond_init(&(aio->idle), NULL);
+    pthread_cond_init(&(aio->work), NULL);
+
+#ifdef HAVE_URING
+    if (backend != POOL_AIO_THREAD && uring_init(aio, depth) == POOL_SUCCESS) {
+        if (pthread_create(aio->thread, NULL, reaper, aio) == 0) {
+            aio->backend = POOL_AIO_URING;
+            aio->nthread = 1;
+            return POOL_SUCCESS;
+        }
+        uring_close(aio);
+    }
+#endif
+    if (backend == POOL_AIO_URING)
+        goto fail;
+
+    // io_uring 을 쓸 수 없으면 입출력 스레드로 대신함 (26.10.19)
+    for (int i = 0; i < POOL_AIO_NTHREAD; i++) {
+        if (pthread_create(aio->thread + i, NULL, io_thread, aio) != 0)
+            break;
+        aio->nthread++;
+    }
+    if (aio->nthread > 0)
+        return POOL_SUCCESS;
+
+fail:
+    pthread_cond_destroy(&(aio->work));
+    pthread_cond_destroy(&(aio->idle));
+    pthread_cond_destroy(&(aio->space));
+    pthread_mutex_destroy(&(aio->mutex));
+    return POOL_FAIL;
+}
+
+/*
+ * pool_aio_read()와 pool_aio_write()의 공통 부분이다.
+ * 자리가 없을 때 flag이 POOL_NOWAIT이면 POOL_FULL을 리턴하고, POOL_WAIT이면 자리가 날 때까지 기다린다.
+ * 일꾼이 기다리는 동안은 blocking 구간으로 표시해서 예비 일꾼이 대기열의 작업을 대신 실행하게 한다.
+ * len이 POOL_AIO_MAXLEN보다 크면 POOL_FAIL을 리턴한다.
+ */
+static int submit(pool_aio_t *aio, int op, int fd, void *buf, size_t len, off_t off,
+                  void (*cb)(void *arg, ssize_t res), void *arg, int flag)
+{
+    struct pool_aio_req *req;
+    bool blocking = false;
+
+    // 제출 항목에 담으면 길이가 잘리므로 받지 않음, 백엔드에 따라 결과가 달라지지 않게 입출력 스레드도 같음 (26.10.19)
+    if (len > POOL_AIO_MAXLEN)
+        return POOL_FAIL;
+    if ((req = (struct pool_aio_req *)malloc(sizeof(struct pool_aio_req))) == NULL)
+        return POOL_FAIL;
+    *req = (struct pool_aio_req){ aio, cb, arg, 0, op, fd, buf, len, off, NULL };
+
+    pthread_mutex_lock(&(aio->mutex));
+    while (aio->running && aio->inflight == aio->depth && flag == POOL_WAIT) {
+        if (!blocking) {
+            pthread_pool_blocking_begin();
+            blocking = true;
+        }
+        pthread_cond_wait(&(aio->space), &(aio->mutex));
+    }
+    int ret = POOL_SUCCESS;
+    if (!aio->running)
+        ret = POOL_FAIL;
+    else if (aio->inflight == aio->depth)
+        ret = POOL_FULL;
+    if (ret != POOL_SUCCESS) {
+        pthread_mutex_unlock(&(aio->mutex));
+        if (blocking)
+            pthread_pool_blocking_end();
+        free(req);
+        return ret;
+    }
+    aio->inflight++;
+    aio->pending++;
+
+#ifdef HAVE_URING
+    // 커널에 넣지 못한 요청은 -errno로 끝난 것으로 보고 후속 함수를 부름 (26.10.19)
+    int err;
+    if (aio->backend == POOL_AIO_URING && (err = uring_push(aio, req)) < 0) {
+        pthread_mutex_unlock(&(aio->mutex));
+        if (blocking)
+            pthread_pool_blocking_end();
+        finish(req, err);
+        return POOL_SUCCESS;
+    }
+#endif
+    if (aio->backend == POOL_AIO_THREAD) {
+        if (aio->tail == NULL)
+            aio->head = req;
+        else
+            aio->tail->next = req;
+        aio->tail = req;
+        pthread_cond_signal(&(aio->work));
+    }
+    pthread_mutex_unlock(&(aio->mutex));
+    if (blocking)
+        pthread_pool_blocking_end();
+    return POOL_SUCCESS;
+}
+
+/*
+ * 파일 기술자 fd의 off 위치에서 최대 len 바이트를 buf로 읽도록 맡긴다.
+ * 읽기가 끝나면 cb(arg, res)가 스레드풀의 작업으로 실행된다. res는 읽은 바이트 수이거나 -errno이다.
+ * buf는 cb가 불릴 때까지 유효해야 한다. 맡기는 데 성공하면 POOL_SUCCESS를 리턴한다.
+ * len이 POOL_AIO_MAXLEN보다 크면 맡기지 않고 POOL_FAIL을 리턴하므로 나눠서 맡겨야 한다.
+ */
+int pool_aio_read(pool_aio_t *aio, int fd, void *buf, size_t len, off_t off,
+                  void (*cb)(void *arg, ssize_t res), void *arg, int flag)
+{
+    return submit(aio, OP_READ, fd, buf, len, off, cb, arg, flag);
+}
+
+/*
+ * 파일 기술자 fd의 off 위치에 buf의 len 바이트를 쓰도록 맡긴다. 나머지는 pool_aio_read()와 같다.
+ */
+int pool_aio_write(pool_aio_t *aio, int fd, const void *buf, size_t len, off_t off,
+                   void (*cb)(void *arg, ssize_t res), void *arg, int flag)
+{
+    return submit(aio, OP_WRITE, fd, (void *)buf, len, off, cb, arg, flag);
+}
+
+/*
+ * 맡긴 요청과 그 후속 함수가 모두 끝날 때까지 기다린 뒤 자원을 반납한다.
+ * 후속 함수는 스레드풀에서 실행되므로 스레드풀보다 먼저 종료해야 하며, 일꾼 안에서 부르면 안 된다.
+ */
+int pool_aio_shutdown(pool_aio_t *aio)
+{
+    pthread_mutex_lock(&(aio->mutex));
+    while (aio->pending > 0)
+        pthread_cond_wait(&(aio->idle), &(aio->mutex));
+    aio->running = false;
+    pthread_cond_broadcast(&(aio->space));
+    pthread_cond_broadcast(&(aio->work));
+#ifdef HAVE_URING
+    // 완료 스레드는 NOP 의 완료를 받고 끝남 (26.10.19)
+    // 넣지 못하면 완료 스레드가 끝나지 않으므로 잠시 쉬었다가 다시 넣음 (26.10.19)
+    if (aio->backend == POOL_AIO_URING)
+        while (uring_push(aio, NULL) < 0)
+            uring_backoff();
+#endif
+    pthread_mutex_unlock(&(aio->mutex));
+
+    for (int i = 0; i < aio->nthread; i++)
+        pthread_join(aio->thread[i], NULL);
+#ifdef HAVE_URING
+    if (aio->backend == POOL_AIO_URING)
+        uring_close(aio);
+#endif
+    pthread_cond_destroy(&(aio->work));
+    pthread_cond_destroy(&(aio->idle));
+    pthread_cond_destroy(&(aio->space));
+    pthread_mutex_destroy(&(aio->mutex));
+    return POOL_SUCCESS;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by DevTae (2019061658 컴퓨터학부 김태현) (26.10.19)
+#ifndef _POOL_AIO_H_
+#define _POOL_AIO_H_
+
+#include <sys/types.h>
+#include "pthread_pool.h"
+
+#define POOL_AIO_AUTO 0
+#define POOL_AIO_URING 1
+#define POOL_AIO_THREAD 2
+#define POOL_AIO_MAXDEPTH 4096
+#define POOL_AIO_NTHREAD 4
+#define POOL_AIO_MAXLEN UINT32_MAX    /* 요청 하나의 최대 길이, io_uring 제출 항목의 길이가 32비트이다 */
+
+struct pool_aio_req;
+
+/*
+ * 스레드풀과 붙여 쓰는 완료 기반 파일 입출력 제어블록 구조체 타입
+ *
+ * 작업은 pool_aio_read()나 pool_aio_write()로 입출력을 맡기고 곧바로 돌아오며, 입출력이 끝나면
+ * 함께 넘긴 후속 함수가 스레드풀의 작업으로 요청된다. 일꾼은 read()나 write()에서 기다리지 않는다.
+ * backend가 POOL_AIO_URING이면 io_uring에 요청을 넣고 완료 스레드 하나가 완료 큐를 거둔다.
+ * io_uring을 쓸 수 없으면 POOL_AIO_THREAD로 바뀌어 입출력 스레드들이 pread()/pwrite()를 대신 부른다.
+ * inflight는 커널이나 입출력 스레드에 맡겨져 아직 끝나지 않은 요청의 수로 depth를 넘지 않는다.
+ * pending은 inflight에 후속 함수가 아직 끝나지 않은 요청까지 더한 수이다.
+ * mutex는 이 구조체를 보호하고, space는 inflight가 depth보다 작아지기를, idle은 pending이 0이
+ * 되기를, work는 POOL_AIO_THREAD에서 입출력 스레드가 요청이 들어오기를 기다리는 조건 변수이다.
+ */
+typedef struct {
+    pthread_pool_t *pool;           /* 후속 함수를 실행할 스레드풀 */
+    int backend;                    /* POOL_AIO_URING 또는 POOL_AIO_THREAD */
+    unsigned depth;                 /* 동시에 맡길 수 있는 요청의 최대 수 */
+    unsigned inflight;              /* 입출력이 끝나지 않은 요청의 수 */
+    unsigned pending;               /* 후속 함수까지 끝나지 않은 요청의 수 */
+    bool running;                   /* 새 요청을 받는지 여부 */
+    pthread_mutex_t mutex;          /* 이 구조체를 접근하기 위한 상호배타 락 */
+    pthread_cond_t space;           /* inflight < depth가 될 때까지 기다리는 곳 */
+    pthread_cond_t idle;            /* pending이 0이 될 때까지 기다리는 곳 */
+    pthread_cond_t work;            /* POOL_AIO_THREAD에서 요청을 기다리는 곳 */
+    pthread_t thread[POOL_AIO_NTHREAD]; /* 완료 스레드 또는 입출력 스레드 */
+    int nthread;                    /* thread 배열에서 쓰는 스레드의 수 */
+    struct pool_aio_req *head;      /* POOL_AIO_THREAD의 요청 대기열 맨 앞 */
+    struct pool_aio_req *tail;      /* POOL_AIO_THREAD의 요청 대기열 맨 뒤 */
+    int ring_fd;                    /* POOL_AIO_URING의 io_uring 파일 기술자 */
+    void *sq_ptr, *cq_ptr;          /* 제출 큐와 완료 큐를 매핑한 주소 */
+    size_t sq_len, cq_len;          /* 제출 큐와 완료 큐를 매핑한 크기 */
+    void *sqes;                     /* 제출 큐 항목 배열 */
+    size_t sqes_len;                /* 제출 큐 항목 배열을 매핑한 크기 */
+    unsigned *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    void *cqes;                     /* 완료 큐 항목 배열 */
+} pool_aio_t;
+
+int pool_aio_init(pool_aio_t *aio, pthread_pool_t *pool, unsigned depth, int backend);
+int pool_aio_read(pool_aio_t *aio, int fd, void *buf, size_t len, off_t off,
+                  void (*cb)(void *arg, ssize_t res), void *arg, int flag);
+int pool_aio_write(pool_aio_t *aio, int fd, const void *buf, size_t len, off_t off,
+                   void (*cb)(void *arg, ssize_t res), void *arg, int flag);
+int pool_aio_shutdown(pool_aio_t *aio);
+
+#endif
@@ -0,0 +1,210 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by DevTae (2019061658 컴퓨터학부 김태현) (26.10.19)
+
+/*
+ * 스레드풀의 성능을 재는 부하 생성기이다.
+ * 작업 종류, 요청 스레드(producer) 수, bee_size, queue_size, POOL_WAIT/POOL_NOWAIT의 조합마다
+ * 새 스레드풀을 만들어 작업을 넣고, 처리량, 요청에서 실행 시작까지의 지연 시간 백분위수,
+ * CPU 사용률을 한 줄씩 CSV로 출력한다. 대기열 방식이나 변경 전후를 비교할 때 쓴다.
+ *
+ * 사용법: pool_bench [-n 작업수] [-p 최대_producer수] [-b 최대_bee_size] [-m mode] [-s 작업종류]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <sys/resource.h>
+#include "pthread_pool.h"
+
+/*
+ * 작업 하나의 기록이다. producer가 요청 직전의 시각을 submit에 적고,
+ * 일꾼이 실행을 시작하면서 지연 시간을 latency에 적는다.
+ */
+typedef struct {
+    uint64_t submit;
+    uint64_t latency;
+} sample_t;
+
+/*
+ * 작업 종류이다. spin_ns만큼 CPU를 쓰고, blocking_every가 0이 아니면
+ * 그만큼마다 한 번씩 blocking 구간 안에서 block_us만큼 잠든다.
+ */
+typedef struct {
+    const char *name;
+    uint64_t spin_ns;
+    int blocking_every;
+    int block_us;
+    int task_div;           /* 작업 수를 이만큼 나눠서 돌림, 긴 작업의 실행 시간을 맞추기 위함 */
+} scenario_t;
+
+static const scenario_t scenarios[] = {
+    { "empty",  0,      0, 0,   1 },
+    { "1us",    1000,   0, 0,   1 },
+    { "100us",  100000, 0, 0,   20 },
+    { "mixed",  1000,   4, 100, 4 },
+};
+
+/*
+ * producer 스레드 하나에 넘기는 정보이다. sample[from, to)의 작업을 넣는다.
+ */
+typedef struct {
+    pthread_pool_t *pool;
+    sample_t *sample;
+    int from, to;
+    int flag;
+    uint64_t full;          /* POOL_NOWAIT에서 POOL_FULL을 받은 횟수 */
+} producer_t;
+
+static const scenario_t *cur;
+static atomic_long seq;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * 스레드풀에서 실행되는 작업이다. 지연 시간을 적은 뒤 작업 종류만큼 일을 한다.
+ */
+static void work(void *param)
+{
+    sample_t *s = (sample_t *)param;
+    uint64_t start = now_ns();
+
+    s->latency = start - s->submit;
+    if (cur->blocking_every && atomic_fetch_add_explicit(&seq, 1, memory_order_relaxed) % cur->blocking_every == 0) {
+        pthread_pool_blocking_begin();
+        usleep(cur->block_us);
+        pthread_pool_blocking_end();
+        return;
+    }
+    while (cur->spin_ns && now_ns() - start < cur->spin_ns)
+        ;
+}
+
+/*
+ * producer 스레드가 수행할 함수이다. POOL_NOWAIT이면 POOL_FULL을 받을 때마다 양보하고 다시 넣는다.
+ * 지연 시간은 처음 넣으려고 한 시각부터 잰다.
+ */
+static void *producer(void *param)
+{
+    producer_t *p = (producer_t *)param;
+
+    for (int i = p->from; i < p->to; i++) {
+        p->sample[i].submit = now_ns();
+        while (pthread_pool_submit(p->pool, work, p->sample + i, p->flag) == POOL_FULL) {
+            p->full++;
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static double cpu_seconds(void)
+{
+    struct rusage ru;
+
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_utime.tv_sec + ru.ru_utime.tv_usec / 1e6 + ru.ru_stime.tv_sec + ru.ru_stime.tv_usec / 1e6;
+}
+
+/*
+ * 조합 하나를 돌리고 CSV 한 줄을 출력한다.
+ * 시간은 첫 producer를 만들기 직전부터 POOL_COMPLETE로 스레드풀을 종료할 때까지 잰다.
+ */
+static void run(const scenario_t *sc, int ntask, int nprod, int bee_size, int queue_size, int flag, int mode)
+{
+    pthread_pool_t pool;
+    pthread_t tid[nprod];
+    producer_t prod[nprod];
+    sample_t *sample = (sample_t *)calloc(ntask, sizeof(sample_t));
+    uint64_t *lat = (uint64_t *)malloc(sizeof(uint64_t) * ntask);
+    uint64_t full = 0;
+
+    cur = sc;
+    atomic_store(&seq, 0);
+    if (pthread_pool_init_mode(&pool, bee_size, queue_size, mode) != POOL_SUCCESS) {
+        fprintf(stderr, "pool_bench: pthread_pool_init_mode(%d, %d, %d) failed\n", bee_size, queue_size, mode);
+        exit(1);
+    }
+
+    double cpu0 = cpu_seconds();
+    uint64_t t0 = now_ns();
+    for (int i = 0; i < nprod; i++) {
+        prod[i] = (producer_t){ &pool, sample, (int)((long)ntask * i / nprod), (int)((long)ntask * (i + 1) / nprod), flag, 0 };
+        pthread_create(tid + i, NULL, producer, prod + i);
+    }
+    for (int i = 0; i < nprod; i++) {
+        pthread_join(tid[i], NULL);
+        full += prod[i].full;
+    }
+    pthread_pool_shutdown(&pool, POOL_COMPLETE);
+    double sec = (now_ns() - t0) / 1e9;
+    double cpu = cpu_seconds() - cpu0;
+
+    for (int i = 0; i < ntask; i++)
+        lat[i] = sample[i].latency;
+    qsort(lat, ntask, sizeof(uint64_t), cmp_u64);
+
+    printf("%s,%d,%d,%d,%d,%s,%d,%.4f,%.0f,%.2f,%.2f,%.2f,%.3f,%llu\n",
+           sc->name, mode, nprod, bee_size, queue_size, flag == POOL_WAIT ? "wait" : "nowait", ntask, sec,
+           ntask / sec, lat[ntask / 2] / 1e3, lat[(int)(ntask * 0.99)] / 1e3, lat[(int)(ntask * 0.999)] / 1e3,
+           cpu / (sec * sysconf(_SC_NPROCESSORS_ONLN)), (unsigned long long)full);
+    fflush(stdout);
+    free(lat);
+    free(sample);
+}
+
+int main(int argc, char *argv[])
+{
+    int ntask = 20000, max_prod = 4, max_bee = 16, mode = POOL_FIFO, opt;
+    const char *only = NULL;
+    static const int queue_sizes[] = { 16, POOL_MAXQSIZE };
+
+    while ((opt = getopt(argc, argv, "n:p:b:m:s:")) != -1) {
+        switch (opt) {
+            case 'n': ntask = atoi(optarg); break;
+            case 'p': max_prod = atoi(optarg); break;
+            case 'b': max_bee = atoi(optarg); break;
+            case 'm': mode = atoi(optarg); break;
+            case 's': only = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-n tasks] [-p max_producers] [-b max_bee_size] [-m mode] [-s scenario]\n", argv[0]);
+                return 1;
+        }
+    }
+    if (ntask < 1 || max_prod < 1 || max_bee < 1 || max_bee > POOL_MAXBSIZE || (mode & (POOL_SHM | POOL_PROC))) {
+        fprintf(stderr, "%s: invalid argument\n", argv[0]);
+        return 1;
+    }
+
+    printf("scenario,mode,producers,bee_size,queue_size,flag,tasks,seconds,throughput,p50_us,p99_us,p999_us,cpu_util,full_retries\n");
+    for (size_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        if (only && strcmp(only, scenarios[s].name) != 0)
+            continue;
+        int n = ntask / scenarios[s].task_div > 0 ? ntask / scenarios[s].task_div : 1;
+        // producer 수는 1 부터 두 배씩, bee_size 는 1 부터 네 배씩 늘림
+        for (int p = 1; p <= max_prod; p *= 2)
+            for (int b = 1; b <= max_bee; b *= 4)
+                for (size_t q = 0; q < sizeof(queue_sizes) / sizeof(queue_sizes[0]); q++)
+                    for (int flag = POOL_WAIT; flag <= POOL_NOWAIT; flag++)
+                        run(scenarios + s, n, p, b, queue_sizes[q], flag, mode);
+    }
+    return 0;
+}
@@ -0,0 +1,276 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by DevTae (Kim Taehyeon / 컴퓨터학과 / 3학년 2019061658)
+
+#include "pool_pipeline.h"
+#include <stdlib.h>
+
+/*
+ * 지금 꺼내서 실행할 수 있는 단계 중 가장 뒤의 단계 번호를, 없으면 -1을 리턴한다.
+ * 대기열에 항목이 있고, 실행 중인 일꾼이 parallelism보다 적고, 다음 단계에 자리가 있어야 한다.
+ * 뒤 단계부터 처리해야 대기열이 빨리 비워져서 앞 단계의 배압이 풀린다. mutex를 쥐고 불러야 한다.
+ */
+static int pick(pool_pipeline_t *pl)
+{
+    for (int i = pl->nstage - 1; i >= 0; i--) {
+        pipe_stage_t *s = pl->stage + i;
+        if (s->q_len == 0 || s->active == s->parallelism)
+            continue;
+        if (i + 1 < pl->nstage && s[1].q_len + s[1].reserved == s[1].q_size)
+            continue;
+        return i;
+    }
+    return -1;
+}
+
+/*
+ * 단계 s의 대기열 끝에 항목을 넣는다. 자리는 호출하는 쪽이 확인했거나 미리 잡아 두었어야 한다.
+ */
+static void stage_push(pipe_stage_t *s, void *item)
+{
+    s->q[(s->q_front + s->q_len) % s->q_size] = item;
+    s->q_len++;
+}
+
+static void runner(void *param);
+
+/*
+ * runner 하나가 빠졌음을 센다. 마지막 runner가 빠지면 drain을 깨우고, 첫 단계가 꽉 찬 채
+ * 기다리는 pool_pipeline_push()도 깨워서 남은 항목이 있으면 직접 처리하게 한다. mutex를 쥐고 불러야 한다.
+ */
+static void leave(pool_pipeline_t *pl)
+{
+    if (--pl->runners == 0) {
+        pthread_cond_broadcast(&(pl->idle));
+        pthread_cond_broadcast(&(pl->space));
+    }
+}
+
+/*
+ * 스레드풀이 POOL_DISCARD로 종료하면서 요청한 runner를 실행하지 않고 버렸을 때 expire로 불린다.
+ * 요청이 실패했을 때도 부른다. 스레드풀은 곧 사라지므로 더 이상 runner를 요청하지 않는다.
+ */
+static void runner_dropped(void *param)
+{
+    pool_pipeline_t *pl = (pool_pipeline_t *)param;
+
+    pthread_mutex_lock(&(pl->mutex));
+    pl->detached = true;
+    leave(pl);
+    pthread_mutex_unlock(&(pl->mutex));
+}
+
+/*
+ * runner 작업을 스레드풀에 요청한다. 버려지면 runner_dropped()가 runners를 되돌린다.
+ */
+static int submit_runner(pool_pipeline_t *pl)
+{
+    return pthread_pool_submit_deadline(pl->pool, runner, pl, NULL, runner_dropped, POOL_NOWAIT);
+}
+
+/*
+ * 실행할 단계가 남아 있고 runners가 상한보다 적으면 runner 작업을 하나 더 요청한다.
+ * mutex를 쥐고 부르며, 요청하는 동안 mutex를 놓지 않도록 기다리지 않는 방식으로 요청한다.
+ * 대기열이 꽉 차서 실패해도 부른 쪽의 runner가 계속 돌기 때문에 일이 멈추지 않는다.
+ */
+static void spawn(pool_pipeline_t *pl)
+{
+    if (pl->detached || pl->runners == pl->max_runners || pick(pl) < 0)
+        return;
+    switch (submit_runner(pl)) {
+        case POOL_SUCCESS:
+            pl->runners++;
+            break;
+        case POOL_FAIL:
+            pl->detached = true;
+            break;
+    }
+}
+
+/*
+ * 도는 runner가 없는데 실행할 단계가 남아 있으면 부른 스레드가 runner가 되어 직접 처리한다.
+ * 마지막 runner는 실행할 단계가 없을 때만 빠지므로, 이런 일은 스레드풀이 종료되어 runner를 요청할 수 없거나
+ * 요청한 runner가 버려졌을 때만 생긴다. mutex를 쥐고 부르며 돌아올 때도 쥐고 있다.
+ * runner를 실행했으면 참을 리턴한다.
+ */
+static bool run_orphaned(pool_pipeline_t *pl)
+{
+    if (pl->runners > 0 || pick(pl) < 0)
+        return false;
+    pl->runners++;
+    pthread_mutex_unlock(&(pl->mutex));
+    runner(pl);
+    pthread_mutex_lock(&(pl->mutex));
+    return true;
+}
+
+/*
+ * 스레드풀의 일꾼이 실행하는 파이프라인 작업이다.
+ * 실행할 수 있는 단계가 없어질 때까지 항목을 하나씩 꺼내서 그 단계의 함수를 실행하고,
+ * 결과를 미리 잡아 둔 다음 단계의 자리에 넣는다. 함수를 실행하는 동안에는 mutex를 놓는다.
+ */
+static void runner(void *param)
+{
+    pool_pipeline_t *pl = (pool_pipeline_t *)param;
+    int i;
+
+    pthread_mutex_lock(&(pl->mutex));
+    while ((i = pick(pl)) >= 0) {
+        pipe_stage_t *s = pl->stage + i;
+
+        // 항목을 꺼내고 다음 단계에 자리를 잡아 둠 (26.10.19)
+        void *item = s->q[s->q_front];
+        s->q_front = (s->q_front + 1) % s->q_size;
+        s->q_len--;
+        s->active++;
+        if (i + 1 < pl->nstage)
+            s[1].reserved++;
+        if (i == 0)
+            pthread_cond_signal(&(pl->space));
+
+        // 남은 일이 있으면 다른 일꾼도 돕게 함
+        spawn(pl);
+        pthread_mutex_unlock(&(pl->mutex));
+
+        void *out = (*(s->function))(item, s->arg);
+
+        pthread_mutex_lock(&(pl->mutex));
+        s->active--;
+        if (i + 1 < pl->nstage) {
+            s[1].reserved--;
+            if (out != NULL)
+                stage_push(s + 1, out);
+        }
+    }
+
+    // 마지막 runner 가 빠지면 파이프라인이 빈 것이므로 drain 을 깨움 (26.10.19)
+    leave(pl);
+    pthread_mutex_unlock(&(pl->mutex));
+}
+
+/*
+ * 스레드풀 pool 위에서 실행할 빈 파이프라인을 만든다.
+ * 성공하면 POOL_SUCCESS를, 실패하면 POOL_FAIL을 리턴한다.
+ */
+int pool_pipeline_init(pool_pipeline_t *pl, pthread_pool_t *pool)
+{
+    pl->pool = pool;
+    pl->nstage = 0;
+    pl->runners = 0;
+    pl->max_runners = 0;
+    pl->detached = false;
+    pthread_mutex_init(&(pl->mutex), NULL);
+    pthread_cond_init(&(pl->space), NULL);
+    pthread_cond_init(&(pl->idle), NULL);
+    return POOL_SUCCESS;
+}
+
+/*
+ * 파이프라인 끝에 단계를 하나 덧붙인다. f는 단계 함수, arg는 f에 넘길 인자이다.
+ * queue_size는 이 단계 앞 대기열의 용량이고, parallelism은 이 단계를 동시에 실행할 일꾼의 최대 수이다.
+ * 첫 항목을 넣기 전에만 부를 수 있다. 성공하면 POOL_SUCCESS를, 실패하면 POOL_FAIL을 리턴한다.
+ */
+int pool_pipeline_add(pool_pipeline_t *pl, void *(*f)(void *item, void *arg), void *arg,
+                      size_t queue_size, int parallelism)
+{
+    if (pl->nstage == PIPE_MAXSTAGE || queue_size < 1 || queue_size > POOL_MAXQSIZE || parallelism < 1)
+        return POOL_FAIL;
+
+    pipe_stage_t *s = pl->stage + pl->nstage;
+    if ((s->q = (void **)malloc(sizeof(void *) * queue_size)) == NULL)
+        return POOL_FAIL;
+    s->function = f;
+    s->arg = arg;
+    s->q_size = queue_size;
+    s->q_front = 0;
+    s->q_len = 0;
+    s->reserved = 0;
+    s->active = 0;
+    s->parallelism = parallelism;
+    pl->max_runners += parallelism;
+    pl->nstage++;
+    return POOL_SUCCESS;
+}
+
+/*
+ * 첫 단계의 대기열에 항목 item을 넣는다. 항목은 포인터만 넘기며 복사하지 않는다.
+ * 첫 단계가 꽉 찬 상황에서 flag이 POOL_NOWAIT이면 즉시 POOL_FULL을, POOL_WAIT이면 빈 자리가
+ * 나올 때까지 기다린다. 뒤 단계가 막혀 있으면 첫 단계도 비지 않으므로 배압이 여기까지 전달된다.
+ * 일이 생겼는데 도울 runner가 모자라면 스레드풀에 runner를 요청한다. 스레드풀의 대기열이 꽉 차서
+ * 요청할 수 없고 도는 runner도 없으면 부른 스레드가 직접 runner를 실행한다.
+ * 기다리는 동안 스레드풀이 runner를 버려서 도는 runner가 없어져도 부른 스레드가 직접 비운다.
+ */
+int pool_pipeline_push(pool_pipeline_t *pl, void *item, int flag)
+{
+    pipe_stage_t *s = pl->stage;
+
+    if (pl->nstage == 0)
+        return POOL_FAIL;
+
+    pthread_mutex_lock(&(pl->mutex));
+    while (s->q_len == s->q_size && flag == POOL_WAIT)
+        if (!run_orphaned(pl))
+            pthread_cond_wait(&(pl->space), &(pl->mutex));
+    if (s->q_len == s->q_size) {
+        pthread_mutex_unlock(&(pl->mutex));
+        return POOL_FULL;
+    }
+    stage_push(s, item);
+
+    // 도울 runner 가 모자라면 mutex 를 놓고 기다리는 방식으로 요청 (26.10.19)
+    if (pl->runners == pl->max_runners || pick(pl) < 0) {
+        pthread_mutex_unlock(&(pl->mutex));
+        return POOL_SUCCESS;
+    }
+    pl->runners++;
+    bool detached = pl->detached;
+    pthread_mutex_unlock(&(pl->mutex));
+
+    // 스레드풀에서 떨어졌으면 스레드풀의 대기열이 꽉 찬 것처럼 직접 실행함
+    switch (detached ? POOL_FULL : submit_runner(pl)) {
+        case POOL_SUCCESS:
+            return POOL_SUCCESS;
+        case POOL_FULL:
+            runner(pl);
+            return POOL_SUCCESS;
+        default:
+            // 스레드풀이 종료되어 더 이상 진행할 수 없음
+            runner_dropped(pl);
+            return POOL_FAIL;
+    }
+}
+
+/*
+ * 지금까지 넣은 모든 항목이 마지막 단계까지 처리될 때까지 기다린다.
+ * 스레드풀의 일꾼이 부르면 자기 자신을 기다리는 교착이 생길 수 있으므로 일꾼 밖에서 불러야 한다.
+ * 스레드풀이 runner를 버려서 남은 항목은 부른 스레드가 직접 처리한다.
+ */
+int pool_pipeline_drain(pool_pipeline_t *pl)
+{
+    pthread_mutex_lock(&(pl->mutex));
+    do {
+        while (pl->runners > 0)
+            pthread_cond_wait(&(pl->idle), &(pl->mutex));
+    } while (run_orphaned(pl));
+    pthread_mutex_unlock(&(pl->mutex));
+    return POOL_SUCCESS;
+}
+
+/*
+ * 파이프라인의 모든 항목을 처리한 뒤 자원을 반납한다. 스레드풀은 그대로 남는다.
+ */
+int pool_pipeline_shutdown(pool_pipeline_t *pl)
+{
+    pool_pipeline_drain(pl);
+    for (int i = 0; i < pl->nstage; i++)
+        free(pl->stage[i].q);
+    pl->nstage = 0;
+    pthread_cond_destroy(&(pl->idle));
+    pthread_cond_destroy(&(pl->space));
+    pthread_mutex_destroy(&(pl->mutex));
+    return POOL_SUCCESS;
+}
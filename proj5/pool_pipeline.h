@@ -0,0 +1,68 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by DevTae (2019061658 컴퓨터학부 김태현) (26.10.19)
+#ifndef _POOL_PIPELINE_H_
+#define _POOL_PIPELINE_H_
+
+#include "pthread_pool.h"
+
+#define PIPE_MAXSTAGE 16
+
+/*
+ * 파이프라인의 한 단계를 나타내는 구조체 타입
+ *
+ * function은 앞 단계가 넘긴 항목 item과 단계 인자 arg를 받아서 다음 단계로 넘길 항목을 리턴한다.
+ * NULL을 리턴하면 그 항목은 다음 단계로 넘어가지 않는다. 마지막 단계의 리턴값은 버려진다.
+ * 항목은 포인터만 넘기며 복사하지 않는다.
+ * q는 이 단계로 들어온 항목이 기다리는 원형 버퍼이고, q_size, q_front, q_len의 뜻은 스레드풀과 같다.
+ * reserved는 앞 단계에서 실행 중이라서 곧 이 단계로 들어올 항목의 수로, 자리를 미리 잡아 둔 것이다.
+ * active는 이 단계를 지금 실행하고 있는 일꾼의 수이고, parallelism은 그 상한이다.
+ */
+typedef struct {
+    void *(*function)(void *item, void *arg);
+    void *arg;
+    void **q;               /* 이 단계로 들어온 항목의 원형 버퍼 */
+    int q_size;             /* 원형 버퍼 q 배열의 크기 */
+    int q_front;            /* 다음에 꺼낼 항목의 위치 */
+    int q_len;              /* 기다리는 항목의 수 */
+    int reserved;           /* 앞 단계에서 곧 들어올 항목의 수 */
+    int active;             /* 이 단계를 실행 중인 일꾼의 수 */
+    int parallelism;        /* active의 상한 */
+} pipe_stage_t;
+
+/*
+ * 하나의 스레드풀 위에서 여러 단계를 이어 실행하는 파이프라인 제어블록 구조체 타입
+ *
+ * 각 단계는 자기 앞에 유한한 대기열을 가진다. 어떤 단계는 다음 단계의 대기열에 자리가 있을 때만
+ * 항목을 꺼내므로, 뒤 단계가 막히면 앞 단계가 멈추고 결국 pool_pipeline_push()가 기다린다(배압).
+ * 파이프라인 작업은 스레드풀의 일꾼이 실행하는 runner 작업이 맡으며, runners는 스레드풀에
+ * 요청했거나 실행 중인 runner의 수, max_runners는 그 상한(모든 단계의 parallelism의 합)이다.
+ * detached는 스레드풀이 종료되어 runner를 요청할 수 없거나 요청한 runner를 버렸음을 뜻하며,
+ * 이후로는 스레드풀에 손대지 않고 push나 drain을 부른 스레드가 직접 runner를 실행한다.
+ * mutex는 모든 단계의 대기열을 보호하고, space는 첫 단계에 빈 자리가, idle은 파이프라인이 모두
+ * 비기를 기다리는 조건 변수이다.
+ */
+typedef struct {
+    pthread_pool_t *pool;           /* 파이프라인을 실행할 스레드풀 */
+    pipe_stage_t stage[PIPE_MAXSTAGE];
+    int nstage;                     /* 단계의 수 */
+    int runners;                    /* 요청했거나 실행 중인 runner 작업의 수 */
+    int max_runners;                /* runners의 상한 */
+    bool detached;                  /* 스레드풀에 더 이상 runner를 요청하지 않는지 */
+    pthread_mutex_t mutex;          /* 단계의 대기열을 접근하기 위한 상호배타 락 */
+    pthread_cond_t space;           /* 첫 단계 대기열에 빈 자리가 생길 때까지 기다리는 곳 */
+    pthread_cond_t idle;            /* 파이프라인이 모두 빌 때까지 기다리는 곳 */
+} pool_pipeline_t;
+
+int pool_pipeline_init(pool_pipeline_t *pl, pthread_pool_t *pool);
+int pool_pipeline_add(pool_pipeline_t *pl, void *(*f)(void *item, void *arg), void *arg,
+                      size_t queue_size, int parallelism);
+int pool_pipeline_push(pool_pipeline_t *pl, void *item, int flag);
+int pool_pipeline_drain(pool_pipeline_t *pl);
+int pool_pipeline_shutdown(pool_pipeline_t *pl);
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by DevTae (2019061658 컴퓨터학부 김태현) (26.10.19)
+
+/*
+ * client.c의 isprime()(시행 나눗셈)과 isprime_batch()(밀러-라빈)를 비교하는 벤치마크이다.
+ * 크기별로 임의의 홀수를, 그리고 client.c의 find_primes가 검사하는 구간을 판정하면서
+ * 수 하나당 걸린 시간을 CSV로 출력하고, 두 결과가 모두 같은지 확인한다.
+ * mr_scalar는 isprime_batch()를 수 하나씩 불러서 여러 수를 엇갈려 실행하는 효과를 뺀 값이다.
+ *
+ * 사용법: prime_bench [-s 배율]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "primes.h"
+
+/*
+ * client.c의 isprime()과 같은 시행 나눗셈이다.
+ */
+static bool isprime(uint64_t n)
+{
+    uint64_t p = 5;
+
+    if (n == 2 || n == 3)
+        return true;
+    if (n == 1 || n % 2 == 0 || n % 3 == 0)
+        return false;
+    while (n >= p*p)
+        if (n % p == 0 || n % (p + 2) == 0)
+            return false;
+        else
+            p += 6;
+    return true;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t rng = 0x2545f4914f6cdd1dULL;
+
+static uint64_t next_rand(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return rng;
+}
+
+/*
+ * 수 배열 v[0..count-1]을 세 가지 방법으로 판정하고 CSV 한 줄을 출력한다.
+ * 시행 나눗셈은 큰 수에서 너무 느리므로 앞의 trial개만 재서 수 하나당 시간으로 환산한다.
+ */
+static void run(const char *name, const uint64_t *v, size_t count, size_t trial)
+{
+    bool *a = (bool *)malloc(count), *b = (bool *)malloc(count), *c = (bool *)malloc(count);
+    size_t primes = 0;
+
+    uint64_t t0 = now_ns();
+    for (size_t i = 0; i < trial; i++)
+        a[i] = isprime(v[i]);
+    uint64_t t1 = now_ns();
+    for (size_t i = 0; i < count; i++)
+        isprime_batch(v + i, 1, b + i);
+    uint64_t t2 = now_ns();
+    isprime_batch(v, count, c);
+    uint64_t t3 = now_ns();
+
+    bool agree = true;
+    for (size_t i = 0; i < count; i++) {
+        agree = agree && b[i] == c[i] && (i >= trial || a[i] == c[i]);
+        primes += c[i];
+    }
+    double trial_ns = (double)(t1 - t0) / trial, scalar_ns = (double)(t2 - t1) / count, batch_ns = (double)(t3 - t2) / count;
+    printf("%s,%zu,%zu,%.1f,%.1f,%.1f,%.1f,%s\n", name, count, primes, trial_ns, scalar_ns, batch_ns,
+           trial_ns / batch_ns, agree ? "yes" : "NO");
+    fflush(stdout);
+    free(a);
+    free(b);
+    free(c);
+}
+
+int main(int argc, char *argv[])
+{
+    static const int bits[] = { 20, 32, 40, 48, 60 };
+    static const size_t trials[] = { 100000, 100000, 20000, 2000, 200 };
+    int scale = 1, opt;
+    char name[32];
+
+    while ((opt = getopt(argc, argv, "s:")) != -1) {
+        if (opt != 's' || (scale = atoi(optarg)) < 1) {
+            fprintf(stderr, "usage: %s [-s scale]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    printf("workload,count,primes,trial_ns,mr_scalar_ns,mr_batch_ns,speedup,agree\n");
+    for (size_t k = 0; k < sizeof(bits) / sizeof(bits[0]); k++) {
+        size_t count = 100000 * scale;
+        uint64_t *v = (uint64_t *)malloc(sizeof(uint64_t) * count);
+        for (size_t i = 0; i < count; i++)
+            v[i] = (next_rand() >> (64 - bits[k])) | 1 | (1ULL << (bits[k] - 1));
+        snprintf(name, sizeof(name), "random%d", bits[k]);
+        run(name, v, count, trials[k] * scale < count ? trials[k] * scale : count);
+        free(v);
+    }
+
+    // client.c 의 find_primes 가 POOL_COMPLETE 검사에서 보는 16*100 개의 수
+    uint64_t v[1600];
+    for (int i = 0; i < 1600; i++)
+        v[i] = 0x0fffffff00000000 + i;
+    run("find_primes", v, 1600, 100 * scale < 1600 ? 100 * scale : 1600);
+    return 0;
+}
@@ -0,0 +1,506 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by DevTae (Kim Taehyeon / 컴퓨터학과 / 3학년 2019061658)
+
+#include "primes.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#define MIN(a,b) (((a)<(b))?(a):(b))
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#define PRESIEVE_LEN 15015          // 3*5*7*11*13, 미리 걸러 둔 무늬의 주기(홀수 개수 단위)
+#define PRESIEVE_MAX 13             // 무늬로 미리 거르는 가장 큰 소수
+#define MR_CHUNK 64                 // isprime_batch()가 모아서 판정하는 수의 최대 개수
+
+/*
+ * 홀수 2j+1이 3, 5, 7, 11, 13 중 어느 것으로도 나누어지지 않으면 presieve[j]가 1이다.
+ * 조각마다 이 무늬를 복사해서 시작하면 작은 소수의 배수를 지우는 일을 건너뛸 수 있다(바퀴, wheel).
+ * 짝수는 처음부터 표시하지 않으므로 2의 바퀴도 함께 쓰는 셈이다.
+ */
+static uint8_t presieve[PRESIEVE_LEN];
+static pthread_once_t presieve_once = PTHREAD_ONCE_INIT;
+
+static void presieve_init(void)
+{
+    static const int small[] = { 3, 5, 7, 11, 13 };
+
+    memset(presieve, 1, sizeof(presieve));
+    for (int k = 0; k < 5; k++)
+        for (int j = (small[k] - 1) / 2; j < PRESIEVE_LEN; j += small[k])
+            presieve[j] = 0;
+}
+
+/*
+ * n의 정수 제곱근을 리턴한다. 결과는 2^32보다 작으므로 곱셈이 넘치지 않는다.
+ */
+static uint64_t isqrt(uint64_t n)
+{
+    uint64_t lo = 0, hi = 1ULL << 32;
+
+    while (hi - lo > 1) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (mid * mid <= n)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/*
+ * 홀수 번호 [base, base+len)에 해당하는 홀수 2j+1들을 체로 걸러 buf에 표시한다.
+ * buf[j]가 1이면 2(base+j)+1은 소수이다. bp는 조각의 마지막 수의 제곱근까지의 홀수 소수 표이며,
+ * 무늬로 미리 거른 소수는 건너뛰고 나머지 소수 p는 p*p부터 홀수 배수만 지운다.
+ */
+static void sieve_segment(const uint32_t *bp, size_t nbp, uint64_t base, size_t len, uint8_t *buf)
+{
+    uint64_t first = 2 * base + 1, last = 2 * (base + len - 1) + 1;
+
+    // 무늬를 복사해서 시작함 (26.10.19)
+    for (size_t j = 0, off = base % PRESIEVE_LEN; j < len; off = 0) {
+        size_t n = MIN(len - j, PRESIEVE_LEN - off);
+        memcpy(buf + j, presieve + off, n);
+        j += n;
+    }
+
+    for (size_t k = 0; k < nbp; k++) {
+        uint64_t p = bp[k];
+        if (p <= PRESIEVE_MAX)
+            continue;
+        if (p * p > last)
+            break;
+        // 조각 안의 첫 홀수 배수, 2^64 근처에서 넘치지 않도록 128비트로 셈
+        unsigned __int128 m = p * p;
+        if (m < first)
+            m = ((unsigned __int128)first + p - 1) / p * p;
+        if ((m & 1) == 0)
+            m += p;
+        unsigned __int128 j0 = (m - 1) / 2 - base;
+        for (size_t j = j0 < len ? (size_t)j0 : len; j < len; j += p)
+            buf[j] = 0;
+    }
+
+    // 1은 소수가 아니고, 무늬로 지운 3..13 은 소수이므로 되살림
+    if (base == 0)
+        buf[0] = 0;
+    for (uint64_t q = 3; q <= PRESIEVE_MAX; q += 2)
+        if (q >= first && q <= last && (q % 3 != 0 || q == 3))
+            buf[(q - 1) / 2 - base] = 1;
+}
+
+/*
+ * limit 이하의 홀수 소수를 모두 구해 새로 할당한 배열로 리턴하고, 개수를 *n에 담는다.
+ * limit의 제곱근까지는 단순한 체로, 그 위는 같은 구간 체로 구한다. 실패하면 NULL을 리턴한다.
+ */
+static uint32_t *base_primes(uint64_t limit, size_t *n)
+{
+    uint64_t r = isqrt(limit);
+    size_t cap = 1024, len = 0, nsp = 0;
+    uint32_t *bp = (uint32_t *)malloc(sizeof(uint32_t) * cap);
+    uint32_t *sp = (uint32_t *)malloc(sizeof(uint32_t) * (r / 2 + 1));
+    uint8_t *mark = (uint8_t *)calloc(r + 1, 1);
+    uint8_t *buf = (uint8_t *)malloc(PRIMES_SEGSIZE);
+
+    if (bp == NULL || sp == NULL || mark == NULL || buf == NULL)
+        goto fail;
+
+    // 제곱근까지의 홀수 소수는 단순한 체로 구함
+    for (uint64_t i = 3; i <= r; i += 2) {
+        if (mark[i])
+            continue;
+        sp[nsp++] = i;
+        for (uint64_t j = i * i; j <= r; j += 2 * i)
+            mark[j] = 1;
+    }
+
+    // 나머지는 조각 단위로 걸러서 모음
+    for (uint64_t base = 1; 2 * base + 1 <= limit; base += PRIMES_SEGSIZE) {
+        size_t seglen = MIN(PRIMES_SEGSIZE, (limit - 1) / 2 + 1 - base);
+        sieve_segment(sp, nsp, base, seglen, buf);
+        for (size_t j = 0; j < seglen; j++) {
+            if (!buf[j])
+                continue;
+            if (len == cap) {
+                uint32_t *tmp = (uint32_t *)realloc(bp, sizeof(uint32_t) * (cap *= 2));
+                if (tmp == NULL)
+                    goto fail;
+                bp = tmp;
+            }
+            bp[len++] = (uint32_t)(2 * (base + j) + 1);
+        }
+    }
+    free(buf);
+    free(mark);
+    free(sp);
+    *n = len;
+    return bp;
+
+fail:
+    free(buf);
+    free(mark);
+    free(sp);
+    free(bp);
+    return NULL;
+}
+
+/*
+ * 조각들을 여러 일꾼이 나눠 거르는 작업 하나의 정보이다.
+ * 조각 k는 홀수 번호 [i_lo + k*PRIMES_SEGSIZE, ...)를 맡으며, 일꾼은 next를 fetch_add 해서 조각을 가져간다.
+ * count[k]에 조각 k의 소수 개수를, list가 NULL이 아니면 list[k]에 앞에서부터 최대 max개의 소수를 담는다.
+ * runners는 아직 끝나지 않았거나 버려지지 않은 sieve_task의 수이며 0이 되면 done으로 알린다.
+ * failed는 메모리가 모자란 일꾼들이 락 없이 세우므로 atomic이다.
+ */
+struct sieve_job {
+    const uint32_t *bp;
+    size_t nbp;
+    uint64_t i_lo, i_hi;
+    uint64_t nseg;
+    _Atomic uint64_t next;
+    uint64_t *count;
+    uint64_t **list;
+    size_t max;
+    atomic_bool failed;
+    int runners;
+    pthread_mutex_t mutex;
+    pthread_cond_t done;
+};
+
+/*
+ * 거르기 작업 하나가 끝났거나 스레드풀이 POOL_DISCARD로 종료하면서 실행하지 않고 버렸음을 알린다.
+ * 버려진 작업이 맡았을 조각은 부른 스레드가 이미 걸렀으므로 runners만 줄인다.
+ */
+static void sieve_leave(void *param)
+{
+    struct sieve_job *job = (struct sieve_job *)param;
+
+    pthread_mutex_lock(&(job->mutex));
+    if (--job->runners == 0)
+        pthread_cond_signal(&(job->done));
+    pthread_mutex_unlock(&(job->mutex));
+}
+
+/*
+ * 스레드풀의 일꾼이나 부른 스레드가 실행하는 거르기 작업이다.
+ * 가져갈 조각이 없을 때까지 조각을 하나씩 걸러서 결과를 남긴다.
+ * 조각 버퍼는 일꾼이면 pthread_pool_scratch()에서, 아니면 malloc()으로 얻는다.
+ */
+static void sieve_task(void *param)
+{
+    struct sieve_job *job = (struct sieve_job *)param;
+    uint8_t *buf = (uint8_t *)pthread_pool_scratch(PRIMES_SEGSIZE), *heap = NULL;
+    uint64_t k;
+
+    if (buf == NULL)
+        buf = heap = (uint8_t *)malloc(PRIMES_SEGSIZE);
+    while (buf != NULL && (k = atomic_fetch_add_explicit(&job->next, 1, memory_order_relaxed)) < job->nseg) {
+        uint64_t base = job->i_lo + k * PRIMES_SEGSIZE;
+        size_t len = MIN(PRIMES_SEGSIZE, job->i_hi - base);
+        uint64_t c = 0;
+
+        sieve_segment(job->bp, job->nbp, base, len, buf);
+        for (size_t j = 0; j < len; j++)
+            c += buf[j];
+        job->count[k] = c;
+        if (job->list == NULL)
+            continue;
+
+        // 이 조각이 넘길 수 있는 소수는 최대 max 개, 넘길 것이 없으면 목록을 만들지 않음
+        size_t m = MIN(c, job->max);
+        if (m == 0)
+            continue;
+        uint64_t *out = (uint64_t *)malloc(sizeof(uint64_t) * m);
+        if ((job->list[k] = out) == NULL) {
+            atomic_store_explicit(&job->failed, true, memory_order_relaxed);
+            continue;
+        }
+        for (size_t j = 0, n = 0; j < len && n < job->max; j++)
+            if (buf[j])
+                out[n++] = 2 * (base + j) + 1;
+    }
+    free(heap);
+
+    if (buf == NULL)
+        atomic_store_explicit(&job->failed, true, memory_order_relaxed);
+    sieve_leave(job);
+}
+
+/*
+ * [lo, hi) 구간의 소수를 구간 체로 찾는다. 개수를 리턴하고, out이 NULL이 아니면 작은 것부터
+ * 최대 max개를 out에 담는다. 조각은 pool의 일꾼들이 나눠 거르며 부른 스레드도 함께 거른다.
+ * pool이 NULL이면 부른 스레드 혼자 거른다. 일꾼 안에서 불러도 기다리는 동안 예비 일꾼이 돌기 때문에
+ * 교착되지 않는다. 메모리가 모자라면 UINT64_MAX를 리턴한다.
+ */
+static uint64_t sieve_range(pthread_pool_t *pool, uint64_t lo, uint64_t hi, uint64_t *out, size_t max)
+{
+    struct sieve_job job;
+    uint64_t total = 0, stored = 0;
+
+    if (hi <= lo)
+        return 0;
+    pthread_once(&presieve_once, presieve_init);
+
+    // 2 는 홀수 번호로 나타낼 수 없으므로 따로 셈 (26.10.19)
+    if (lo <= 2 && 2 < hi) {
+        total++;
+        if (out != NULL && stored < max)
+            out[stored++] = 2;
+    }
+    job.i_lo = lo / 2;
+    job.i_hi = hi / 2;
+    if (job.i_hi <= job.i_lo)
+        return total;
+
+    size_t nbp;
+    uint32_t *bp = base_primes(isqrt(hi - 1), &nbp);
+    if (bp == NULL)
+        return UINT64_MAX;
+    job.bp = bp;
+    job.nbp = nbp;
+    job.nseg = (job.i_hi - job.i_lo + PRIMES_SEGSIZE - 1) / PRIMES_SEGSIZE;
+    atomic_init(&job.next, 0);
+    job.count = (uint64_t *)calloc(job.nseg, sizeof(uint64_t));
+    job.list = out != NULL ? (uint64_t **)calloc(job.nseg, sizeof(uint64_t *)) : NULL;
+    job.max = max - stored;
+    atomic_init(&job.failed, job.count == NULL || (out != NULL && job.list == NULL));
+    job.runners = 1;
+    pthread_mutex_init(&(job.mutex), NULL);
+    pthread_cond_init(&(job.done), NULL);
+
+    if (!atomic_load_explicit(&job.failed, memory_order_relaxed)) {
+        // 일꾼 수만큼 거르기 작업을 요청하고 부른 스레드도 하나를 맡음
+        // 요청한 작업이 종료로 버려져도 기다림이 끝나도록 expire 로 sieve_leave 를 줌
+        int helpers = pool != NULL && !(pool->mode & POOL_PROC) ? (int)MIN((uint64_t)pool->bee_size, job.nseg - 1) : 0;
+        for (int i = 0; i < helpers; i++) {
+            pthread_mutex_lock(&(job.mutex));
+            job.runners++;
+            pthread_mutex_unlock(&(job.mutex));
+            if (pthread_pool_submit_deadline(pool, sieve_task, &job, NULL, sieve_leave, POOL_NOWAIT) != POOL_SUCCESS) {
+                pthread_mutex_lock(&(job.mutex));
+                job.runners--;
+                pthread_mutex_unlock(&(job.mutex));
+                break;
+            }
+        }
+        sieve_task(&job);
+
+        pthread_pool_blocking_begin();
+        pthread_mutex_lock(&(job.mutex));
+        while (job.runners > 0)
+            pthread_cond_wait(&(job.done), &(job.mutex));
+        pthread_mutex_unlock(&(job.mutex));
+        pthread_pool_blocking_end();
+    } else {
+        job.runners = 0;
+    }
+
+    // 조각 순서대로 합치고 앞에서부터 out 을 채움
+    bool failed = atomic_load_explicit(&job.failed, memory_order_relaxed);
+    for (uint64_t k = 0; k < job.nseg && !failed; k++) {
+        total += job.count[k];
+        if (job.list == NULL)
+            continue;
+        for (uint64_t j = 0; j < job.count[k] && stored < max; j++)
+            out[stored++] = job.list[k][j];
+    }
+    if (job.list != NULL)
+        for (uint64_t k = 0; k < job.nseg; k++)
+            free(job.list[k]);
+    if (failed)
+        total = UINT64_MAX;
+    free(job.list);
+    free(job.count);
+    free(bp);
+    pthread_cond_destroy(&(job.done));
+    pthread_mutex_destroy(&(job.mutex));
+    return total;
+}
+
+/*
+ * [lo, hi) 구간에 있는 소수의 개수를 리턴한다.
+ * 구간 체는 hi의 제곱근까지의 소수 표를 먼저 만들기 때문에 구간이 아주 좁고 수가 크면
+ * 표를 만드는 비용이 더 크다. 그런 경우에는 수마다 판정하는 편이 낫다.
+ */
+uint64_t primes_count(pthread_pool_t *pool, uint64_t lo, uint64_t hi)
+{
+    return sieve_range(pool, lo, hi, NULL, 0);
+}
+
+/*
+ * [lo, hi) 구간의 소수를 작은 것부터 최대 max개까지 out에 담고, 구간에 있는 소수의 개수를 리턴한다.
+ * 리턴값이 max보다 크면 out에 담지 못한 소수가 있다는 뜻이다.
+ */
+uint64_t primes_list(pthread_pool_t *pool, uint64_t lo, uint64_t hi, uint64_t *out, size_t max)
+{
+    return sieve_range(pool, lo, hi, out, max);
+}
+
+/*
+ * 64비트 홀수 n에 대한 몽고메리 표현의 정보이다. R = 2^64이고, ninv는 n의 2^64에 대한 역원,
+ * one은 1의 몽고메리 표현(R mod n), r2는 R^2 mod n이다.
+ */
+typedef struct {
+    uint64_t n;
+    uint64_t ninv;
+    uint64_t one;
+    uint64_t r2;
+} mont_t;
+
+static void mont_init(mont_t *m, uint64_t n)
+{
+    uint64_t inv = n;
+
+    // 뉴턴 반복 한 번에 맞는 비트 수가 두 배가 되므로 다섯 번이면 64비트가 맞음
+    for (int i = 0; i < 5; i++)
+        inv *= 2 - n * inv;
+    m->n = n;
+    m->ninv = inv;
+    m->one = (0 - n) % n;
+    m->r2 = (unsigned __int128)m->one * m->one % n;
+}
+
+/*
+ * a*b/R mod n을 리턴한다. a, b < n이어야 한다.
+ * T + m*n 대신 hi(T) - hi(m*n)을 써서 n이 2^63보다 커도 128비트를 넘치지 않게 한다.
+ */
+static inline uint64_t mont_mul(const mont_t *m, uint64_t a, uint64_t b)
+{
+    unsigned __int128 t = (unsigned __int128)a * b;
+    uint64_t q = (uint64_t)t * m->ninv;
+    uint64_t h = (uint64_t)((unsigned __int128)q * m->n >> 64);
+    uint64_t r = (uint64_t)(t >> 64) - h;
+
+    return (uint64_t)(t >> 64) < h ? r + m->n : r;
+}
+
+/*
+ * n < 2^64에 대해 결정적인 밀러-라빈 밑 7개이다(Sinclair).
+ */
+static const uint64_t mr_bases[] = { 2, 325, 9375, 28178, 450775, 9780504, 1795265022 };
+
+/*
+ * 밀러-라빈으로 판정하는 중인 수 하나의 정보이다. n-1 = d*2^s이고, minus_one은 -1의 몽고메리 표현이다.
+ */
+typedef struct {
+    mont_t m;
+    uint64_t d;
+    int s;
+    uint64_t minus_one;
+    size_t idx;             /* isprime_batch()의 입력에서의 위치 */
+} mr_t;
+
+/*
+ * c[0..cnt-1] (cnt <= PRIMES_LANES)이 밑 a에 대한 강한 확률적 소수인지 판정해서 pass에 담는다.
+ * 거듭제곱을 모든 수에 대해 한 비트씩 엇갈려 진행하므로, 각 수의 곱셈이 서로의 결과를 기다리지 않고
+ * 겹쳐서 실행된다. d가 짧은 수는 남는 제곱만 더 한다.
+ */
+static void mr_round(const mr_t *c, int cnt, uint64_t a, bool *pass)
+{
+    uint64_t x[PRIMES_LANES], b[PRIMES_LANES];
+    int bits = 0, smax = 0;
+
+    // 밑을 몽고메리 표현으로 바꾸고, n 의 배수인 밑은 그 수에 대해 통과로 봄
+    for (int l = 0; l < cnt; l++) {
+        uint64_t r = a % c[l].m.n;
+        b[l] = mont_mul(&c[l].m, r, c[l].m.r2);
+        x[l] = c[l].m.one;
+        pass[l] = r == 0;
+        bits = MAX(bits, 64 - __builtin_clzll(c[l].d));
+        smax = MAX(smax, c[l].s);
+    }
+    // 아래 비트부터 제곱하며 곱함
+    for (int i = 0; i < bits; i++) {
+        for (int l = 0; l < cnt; l++) {
+            if ((c[l].d >> i) & 1)
+                x[l] = mont_mul(&c[l].m, x[l], b[l]);
+            b[l] = mont_mul(&c[l].m, b[l], b[l]);
+        }
+    }
+    // x 가 1 이나 -1 이면 통과, 아니면 s-1 번 제곱하는 동안 -1 이 나와야 통과
+    for (int l = 0; l < cnt; l++)
+        pass[l] = pass[l] || x[l] == c[l].m.one || x[l] == c[l].minus_one;
+    for (int r = 1; r < smax; r++) {
+        for (int l = 0; l < cnt; l++) {
+            if (pass[l] || r >= c[l].s)
+                continue;
+            x[l] = mont_mul(&c[l].m, x[l], x[l]);
+            pass[l] = x[l] == c[l].minus_one;
+        }
+    }
+}
+
+/*
+ * 작은 소수로 걸러지지 않은 수 c[0..cnt-1]을 판정해서 소수이면 out[c[i].idx]를 참으로 만든다.
+ * 밑 하나를 모든 수에 대해 PRIMES_LANES개씩 돌린 뒤 합성수로 판정된 수는 빼고 다음 밑으로 넘어간다.
+ * 대부분의 합성수는 첫 밑에서 빠지므로 남은 밑은 소수 후보에만 쓰인다.
+ */
+static void mr_batch(mr_t *c, int cnt, bool *out)
+{
+    bool pass[PRIMES_LANES];
+
+    for (size_t k = 0; k < sizeof(mr_bases) / sizeof(mr_bases[0]) && cnt > 0; k++) {
+        int alive = 0;
+        for (int i = 0; i < cnt; i += PRIMES_LANES) {
+            int w = MIN(PRIMES_LANES, cnt - i);
+            mr_round(c + i, w, mr_bases[k], pass);
+            for (int l = 0; l < w; l++)
+                if (pass[l])
+                    c[alive++] = c[i + l];
+        }
+        cnt = alive;
+    }
+    for (int i = 0; i < cnt; i++)
+        out[c[i].idx] = true;
+}
+
+/*
+ * n[0..count-1]의 각 수가 소수인지 판정해서 out에 담는다.
+ * 53 이하의 소수로 나누어 보아 대부분의 합성수를 먼저 걸러 내고, 남은 수는 MR_CHUNK개씩
+ * 모아서 n < 2^64에 대해 결정적인 밀러-라빈(몽고메리 곱셈)으로 판정한다.
+ * 수 하나에 O(log n)번의 곱셈이면 되므로 시행 나눗셈의 O(sqrt n)보다 훨씬 빠르다.
+ */
+void isprime_batch(const uint64_t *n, size_t count, bool *out)
+{
+    static const uint8_t small[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53 };
+    mr_t c[MR_CHUNK];
+    int cnt = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        uint64_t v = n[i];
+        bool decided = false;
+
+        out[i] = false;
+        if (v < 2)
+            continue;
+        for (size_t k = 0; k < sizeof(small); k++) {
+            if (v % small[k] == 0) {
+                out[i] = v == small[k];
+                decided = true;
+                break;
+            }
+        }
+        if (decided)
+            continue;
+        if (v < 59 * 59) {
+            out[i] = true;
+            continue;
+        }
+
+        // 걸러지지 않은 수는 모아 두었다가 한꺼번에 판정
+        mr_t *e = c + cnt++;
+        mont_init(&e->m, v);
+        e->minus_one = v - e->m.one;
+        e->s = __builtin_ctzll(v - 1);
+        e->d = (v - 1) >> e->s;
+        e->idx = i;
+        if (cnt == MR_CHUNK) {
+            mr_batch(c, cnt, out);
+            cnt = 0;
+        }
+    }
+    mr_batch(c, cnt, out);
+}
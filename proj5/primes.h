@@ -0,0 +1,29 @@
+/*
+ * Copyright(c) 2021-2023 All rights reserved by Heekuck Oh.
+ * 이 프로그램은 한양대학교 ERICA 컴퓨터학부 학생을 위한 교육용으로 제작되었다.
+ * 한양대학교 ERICA 학생이 아닌 이는 프로그램을 수정하거나 배포할 수 없다.
+ * 프로그램을 수정할 경우 날짜, 학과, 학번, 이름, 수정 내용을 기록한다.
+ */
+// Developed by DevTae (2019061658 컴퓨터학부 김태현) (26.10.19)
+#ifndef _PRIMES_H_
+#define _PRIMES_H_
+
+#include "pthread_pool.h"
+
+/*
+ * 구간 체의 한 조각(segment)이 다루는 홀수의 개수이다. 조각 하나를 한 바이트씩 표시하므로
+ * 조각의 크기가 L1 캐시에 들어가도록 잡는다.
+ */
+#define PRIMES_SEGSIZE 32768
+
+/*
+ * isprime_batch()가 한꺼번에 검사하는 수의 개수이다. 서로 의존하지 않는 몽고메리 곱셈을
+ * 이만큼 엇갈려 실행해서 곱셈기의 지연 시간을 감춘다.
+ */
+#define PRIMES_LANES 4
+
+uint64_t primes_count(pthread_pool_t *pool, uint64_t lo, uint64_t hi);
+uint64_t primes_list(pthread_pool_t *pool, uint64_t lo, uint64_t hi, uint64_t *out, size_t max);
+void isprime_batch(const uint64_t *n, size_t count, bool *out);
+
+#endif
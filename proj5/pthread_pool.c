@@ -8,7 +8,508 @@
 
 #include "pthread_pool.h"
 #include <stdlib.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #define MAX(a, b) ((a > b) ? a : b) // MAX 함수 선언
+#define HEAP_D 4                    // EDF 대기열로 쓰는 힙의 차수
+#define YIELD_BATCH 4               // pthread_pool_yield() 한 번에 대신 실행하는 최대 작업 수
+#define YIELD_SHORT_NS 1000000ULL   // 평균 실행 시간이 이보다 짧은 작업만 짧은 작업으로 본다
+#define ARENA_ALIGN 16              // pthread_pool_scratch()가 돌려주는 주소의 정렬 단위
+
+/*
+ * 일꾼 스레드별 통계 표의 한 칸이다. 쓰는 쪽은 표의 주인인 일꾼 하나뿐이고,
+ * 읽는 쪽은 pthread_pool_stats()를 부른 스레드이므로 원자적 load/store만으로 충분하다.
+ * key는 작업 함수의 주소이며 0이면 빈 칸이다. 한 번 채워진 칸의 key는 바뀌지 않는다.
+ */
+struct pool_stat_slot {
+    _Atomic uintptr_t key;
+    _Atomic uint64_t count;
+    _Atomic uint64_t wait_ns;
+    _Atomic uint64_t run_ns;
+    _Atomic uint64_t cpu_ns;
+};
+
+/*
+ * POOL_TRACE 모드에서 기록하는 사건의 종류
+ */
+enum { EV_SUBMIT, EV_DEQUEUE, EV_START, EV_END, EV_PARK, EV_WAKE };
+
+/*
+ * 사건 하나를 담는 링 버퍼의 칸이다. seq는 이 칸에 쓴 사건의 번호+1이며 쓰는 도중에는 0이다.
+ * 읽는 쪽은 필드를 읽기 전후의 seq가 같을 때만 그 사건을 믿는다(seqlock 방식).
+ */
+struct pool_trace_event {
+    _Atomic uint64_t seq;
+    _Atomic uint64_t ts;
+    _Atomic uintptr_t fn;
+    _Atomic int type;
+};
+
+/*
+ * 사건 기록용 링 버퍼이다. head는 지금까지 기록된 사건의 수로, 쓰는 쪽이 fetch_add로 칸을 잡는다.
+ * 버퍼가 차면 가장 오래된 사건부터 덮어쓴다. tail은 마지막 flush가 읽은 위치이다.
+ */
+struct pool_trace_ring {
+    _Atomic uint64_t head;
+    uint64_t tail;
+    struct pool_trace_event ev[POOL_TRACESIZE];
+};
+
+/*
+ * 작업 핸들이다. 핸들로 요청한 작업은 대기열에 run_handle(핸들)로 들어간다.
+ * then은 등록된 후속 작업 핸들의 스택이며, 작업이 끝나면 TASK_DONE으로 바뀐다.
+ * 후속 작업끼리는 sibling으로 이어진다. ref는 사용자와 스레드풀이 가진 참조의 수이다.
+ */
+struct pool_task {
+    pthread_pool_t *pool;
+    void (*function)(void *param);
+    void *param;
+    _Atomic(struct pool_task *) then;
+    struct pool_task *sibling;
+    _Atomic int ref;
+};
+
+#define TASK_DONE ((struct pool_task *)1) // 끝난 작업의 then 값
+
+/*
+ * POOL_SHM 스레드풀의 공유 메모리 영역 머리이다. 영역은 이 머리, 작업 대기열 q,
+ * 대기열과 나란한 인자 내용 칸 배열 순으로 놓인다. 프로세스마다 영역이 붙는 주소가 다르므로
+ * 다른 프로세스는 q와 칸을 주소 대신 영역 시작에서의 거리(q_off, slot_off)로 찾는다.
+ * magic은 스레드풀 초기화를 마친 뒤에 써서, 다 만들어지지 않은 영역에 붙는 것을 막는다.
+ * types는 작업 종류 번호별 함수 표로, POOL_PROC의 자식 프로세스가 fork() 뒤에 등록된 함수도
+ * 볼 수 있도록 공유 메모리에 둔다. fork()한 자식은 부모와 같은 주소에 같은 코드를 가진다.
+ * crashed는 POOL_PROC에서 비정상 종료한 자식 프로세스의 수이다.
+ * taking은 mutex를 쥔 쪽이 대기열에서 작업을 꺼내는 중임을, take_front와 take_len은 꺼내기 전의
+ * q_front와 q_len을 적어 둔 것이다. 꺼내던 프로세스가 죽으면 mutex를 넘겨받은 쪽이 보고 고친다.
+ */
+#define SHM_MAGIC 0x314d48534c4f4f50ULL // "POOLSHM1"
+
+struct pool_shm_slot {
+    size_t len;
+    char data[POOL_SHM_PAYLOAD];
+};
+
+struct pool_shm {
+    _Atomic uint64_t magic;
+    size_t map_size;
+    size_t q_off;
+    size_t slot_off;
+    char name[POOL_SHM_NAMELEN];
+    void (*types[POOL_SHM_MAXTYPE])(void *payload, size_t len);
+    int crashed;
+    bool taking;
+    int take_front, take_len;
+    pthread_pool_t pool;
+};
+
+/*
+ * 대기열에서 꺼낸 POOL_SHM 작업의 인자 내용을 일꾼 쪽에 옮겨 둔 것이다.
+ */
+struct pool_inline {
+    size_t len;
+    char data[POOL_SHM_PAYLOAD];
+};
+
+/*
+ * 공유 메모리에 있는 스레드풀 pool의 영역 머리를 돌려준다.
+ */
+static struct pool_shm *shm_of(pthread_pool_t *pool)
+{
+    return (struct pool_shm *)((char *)pool - offsetof(struct pool_shm, pool));
+}
+
+/*
+ * POOL_SHM 스레드풀의 mutex를 쥔 프로세스가 죽어서 EOWNERDEAD로 mutex를 넘겨받았을 때 부른다.
+ * 죽은 쪽이 작업을 꺼내던 중이었으면 꺼내기를 마저 끝내서 그 칸의 작업은 버린다.
+ * 넣던 중이었으면 q_len을 늘리기 전이므로 고칠 것이 없다. 대기열을 고친 뒤 mutex를 다시 쓸 수 있게
+ * 표시하고, 죽은 쪽이 보내지 못했을 신호 대신 기다리는 쪽을 모두 깨운다.
+ */
+static void pool_recover(pthread_pool_t *pool)
+{
+    struct pool_shm *shm = shm_of(pool);
+
+    if (shm->taking) {
+        pool->q_front = (shm->take_front + 1) % pool->q_size;
+        pool->q_len = shm->take_len - 1;
+        shm->taking = false;
+    }
+    pthread_mutex_consistent(&(pool->mutex));
+    pthread_cond_broadcast(&(pool->full));
+    pthread_cond_broadcast(&(pool->empty));
+}
+
+/*
+ * 스레드풀 pool의 mutex를 잡는다. 이전 주인이 쥔 채 죽었으면 pool_recover()로 고친 뒤 돌아온다.
+ */
+static void pool_lock(pthread_pool_t *pool)
+{
+    if (pthread_mutex_lock(&(pool->mutex)) == EOWNERDEAD)
+        pool_recover(pool);
+}
+
+/*
+ * mutex를 쥐고 조건 변수 cond에서 기다린다. 깨어나며 다시 잡은 mutex의 이전 주인이 죽었으면 고친다.
+ */
+static void pool_wait(pthread_pool_t *pool, pthread_cond_t *cond)
+{
+    if (pthread_cond_wait(cond, &(pool->mutex)) == EOWNERDEAD)
+        pool_recover(pool);
+}
+
+/*
+ * 현재 스레드가 일꾼이면 그 일꾼의 지역 정보를, 아니면 NULL을 가리킨다.
+ */
+static __thread pthread_bee_t *self;
+
+/*
+ * 일꾼이 아닌 스레드가 pthread_pool_rand()를 부를 때 쓰는 스레드 지역 난수 상태이다.
+ */
+static __thread uint64_t local_rng[4];
+static __thread bool local_rng_seeded;
+
+static void run_handle(void *param);
+static int enqueue(pthread_pool_t *pool, task_t *task, int flag);
+static int pool_init(pthread_pool_t *pool, size_t bee_size, size_t queue_size, int mode, task_t *q);
+static pthread_pool_t *shm_create(const char *name, size_t bee_size, size_t queue_size, int mode);
+
+/*
+ * CLOCK_MONOTONIC 기준 현재 시각을 ns 단위로 돌려준다.
+ */
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * seed로부터 splitmix64로 xoshiro256** 상태 s를 채운다. 상태가 모두 0이 되는 일은 없다.
+ */
+static void rng_seed(uint64_t s[4], uint64_t seed)
+{
+    for (int i = 0; i < 4; i++) {
+        uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        s[i] = z ^ (z >> 31);
+    }
+}
+
+/*
+ * xoshiro256** 상태 s에서 다음 64비트 난수를 꺼낸다.
+ */
+static uint64_t rng_next(uint64_t s[4])
+{
+    uint64_t r = s[1] * 5;
+    r = ((r << 7) | (r >> 57)) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+    return r;
+}
+
+/*
+ * 현재 스레드가 사용한 CPU 시간을 ns 단위로 돌려준다.
+ */
+static uint64_t cpu_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * 작업 a가 작업 b보다 먼저 실행되어야 하면 참을 돌려준다.
+ * 마감시각이 이른 작업이 먼저이고, 마감시각이 같으면 먼저 들어온 작업이 먼저이다.
+ */
+static bool task_before(const task_t *a, const task_t *b)
+{
+    if (a->deadline != b->deadline)
+        return a->deadline < b->deadline;
+    return a->seq < b->seq;
+}
+
+/*
+ * 대기열에 작업을 하나 넣는다. 호출하는 쪽은 mutex를 쥐고 있어야 하고 빈 자리가 있어야 한다.
+ * POOL_FIFO이면 원형 버퍼의 끝에, POOL_EDF이면 4진 힙에 넣고 위로 올린다. (26.10.19)
+ */
+static void q_push(pthread_pool_t *pool, const task_t *task)
+{
+    if (!(pool->mode & POOL_EDF)) {
+        pool->q[(pool->q_front + pool->q_len) % pool->q_size] = *task;
+        pool->q_len++;
+        return;
+    }
+
+    // 빈 자리에서 시작해서 부모보다 앞서는 동안 부모를 끌어내린다. (26.10.19)
+    int i = pool->q_len++;
+    while (i > 0) {
+        int parent = (i - 1) / HEAP_D;
+        if (!task_before(task, pool->q + parent))
+            break;
+        pool->q[i] = pool->q[parent];
+        i = parent;
+    }
+    pool->q[i] = *task;
+}
+
+/*
+ * 대기열에서 다음에 실행할 작업을 꺼낸다. 호출하는 쪽은 mutex를 쥐고 있어야 하고 q_len > 0이어야 한다.
+ * POOL_EDF이면 힙의 뿌리를 꺼내고 마지막 원소를 아래로 내려 빈 자리를 메운다. (26.10.19)
+ */
+static task_t q_pop(pthread_pool_t *pool)
+{
+    task_t top;
+
+    if (!(pool->mode & POOL_EDF)) {
+        top = pool->q[pool->q_front];
+        pool->q_front = (pool->q_front + 1) % pool->q_size;
+        pool->q_len--;
+        return top;
+    }
+
+    top = pool->q[0];
+    task_t last = pool->q[--pool->q_len];
+    int i = 0;
+    while (true) {
+        int child = i * HEAP_D + 1;
+        if (child >= pool->q_len)
+            break;
+        // 자식 HEAP_D 개 가운데 가장 앞서는 작업을 고른다.
+        int best = child;
+        int end = child + HEAP_D < pool->q_len ? child + HEAP_D : pool->q_len;
+        for (int c = child + 1; c < end; c++)
+            if (task_before(pool->q + c, pool->q + best))
+                best = c;
+        if (!task_before(pool->q + best, &last))
+            break;
+        pool->q[i] = pool->q[best];
+        i = best;
+    }
+    pool->q[i] = last;
+    return top;
+}
+
+/*
+ * 일꾼 bee의 통계 표에서 작업 함수 f의 칸을 찾는다. 함수 주소로 해시한 칸부터 차례로 찾아간다.
+ * create가 참이면 빈 칸을 f의 칸으로 만들고, 표가 꽉 차면 넘친 함수를 모으는 마지막 칸을 돌려준다.
+ * create가 거짓이면 f의 칸이 없을 때 NULL을 돌려준다. 표의 주인만 부를 수 있다.
+ */
+static struct pool_stat_slot *stat_find(pthread_bee_t *bee, void (*f)(void *), bool create)
+{
+    uintptr_t key = (uintptr_t)f;
+
+    for (int n = 0, i = (key >> 4) % (POOL_STATSIZE - 1); n < POOL_STATSIZE - 1; n++, i = (i + 1) % (POOL_STATSIZE - 1)) {
+        uintptr_t k = atomic_load_explicit(&bee->stat[i].key, memory_order_relaxed);
+        if (k == key)
+            return bee->stat + i;
+        if (k == 0) {
+            if (!create)
+                return NULL;
+            atomic_store_explicit(&bee->stat[i].key, key, memory_order_release);
+            return bee->stat + i;
+        }
+    }
+    return create ? bee->stat + POOL_STATSIZE - 1 : NULL;
+}
+
+/*
+ * 일꾼 bee의 통계 표에 작업 함수 f의 실행 기록 한 건을 더한다.
+ * 표의 주인만 부르므로 각 값은 relaxed load 후 relaxed store로 갱신해도 된다. (26.10.19)
+ */
+static void stat_record(pthread_bee_t *bee, void (*f)(void *), uint64_t wait, uint64_t run, uint64_t cpu)
+{
+    struct pool_stat_slot *e = stat_find(bee, f, true);
+
+    atomic_store_explicit(&e->count, atomic_load_explicit(&e->count, memory_order_relaxed) + 1, memory_order_relaxed);
+    atomic_store_explicit(&e->wait_ns, atomic_load_explicit(&e->wait_ns, memory_order_relaxed) + wait, memory_order_relaxed);
+    atomic_store_explicit(&e->run_ns, atomic_load_explicit(&e->run_ns, memory_order_relaxed) + run, memory_order_relaxed);
+    atomic_store_explicit(&e->cpu_ns, atomic_load_explicit(&e->cpu_ns, memory_order_relaxed) + cpu, memory_order_relaxed);
+}
+
+/*
+ * POOL_TRACE 모드이면 사건 하나를 링 버퍼 ring에 기록한다.
+ * 칸을 잡은 뒤 seq를 0으로 만들고 필드를 채운 다음 seq를 사건 번호+1로 바꾼다. (26.10.19)
+ */
+static void trace(pthread_pool_t *pool, int ring, int type, void (*f)(void *))
+{
+    if (!(pool->mode & POOL_TRACE))
+        return;
+
+    struct pool_trace_ring *r = pool->trace + ring;
+    uint64_t i = atomic_fetch_add_explicit(&r->head, 1, memory_order_relaxed);
+    struct pool_trace_event *e = r->ev + i % POOL_TRACESIZE;
+
+    atomic_store_explicit(&e->seq, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&e->ts, now_ns() - pool->trace_t0, memory_order_relaxed);
+    atomic_store_explicit(&e->fn, (uintptr_t)f, memory_order_relaxed);
+    atomic_store_explicit(&e->type, type, memory_order_relaxed);
+    atomic_store_explicit(&e->seq, i + 1, memory_order_release);
+}
+
+/*
+ * 일꾼 bee가 작업 task의 함수를 부른다. 종류 번호로 요청한 작업은 q_take()가 옮겨 둔 인자 내용을
+ * 등록된 함수에 넘겨 부르며, 등록되지 않은 종류이면 아무것도 하지 않는다.
+ * yield는 중첩되지 않으므로 꺼낼 때와 부를 때의 yield 중첩 깊이가 같다.
+ */
+static void call_task(pthread_bee_t *bee, task_t *task)
+{
+    if (task->function != NULL) {
+        (*(task->function))(task->param);
+        return;
+    }
+
+    void (*f)(void *, size_t) = bee->pool->types[(int)(intptr_t)task->param];
+    struct pool_inline *in = bee->inline_buf + bee->yield_depth;
+    if (f != NULL)
+        (*f)(in->data, in->len);
+}
+
+/*
+ * 작업 task를 통계와 yield 판단에서 구분하는 함수를 돌려준다. 대기열에 있는 작업이나 꺼낸 작업 모두에 쓴다.
+ * 핸들로 요청한 작업은 run_handle 대신 사용자 함수로, 종류 번호로 요청한 작업은 등록된 함수로 본다.
+ */
+static void (*task_key(pthread_pool_t *pool, const task_t *task))(void *)
+{
+    if (task->function == run_handle)
+        return ((pool_task_t *)task->param)->function;
+    if (task->function == NULL)
+        return (void (*)(void *))pool->types[(int)(intptr_t)task->param];
+    return task->function;
+}
+
+/*
+ * 일꾼 bee가 대기열에서 다음 작업을 꺼낸다. mutex를 쥐고 불러야 하며 q_len > 0이어야 한다.
+ * 종류 번호로 요청한 작업이면 mutex를 놓은 뒤 칸이 재사용되기 전에 인자 내용을 일꾼 쪽으로 옮긴다.
+ * param은 종류 번호 그대로 두며, 옮길 곳은 yield 중첩 깊이마다 따로 둔다.
+ */
+static task_t q_take(pthread_bee_t *bee)
+{
+    pthread_pool_t *pool = bee->pool;
+    int slot = pool->q_front;
+
+    // 꺼내는 도중에 죽어도 넘겨받은 쪽이 고칠 수 있게 꺼내기 전 위치를 먼저 적어 둠 (26.10.19)
+    // 죽는 시점은 시그널처럼 어디든 될 수 있으므로 컴파일러가 저장 순서를 바꾸지 못하게 막음
+    if (pool->mode & POOL_SHM) {
+        struct pool_shm *shm = shm_of(pool);
+        shm->take_front = slot;
+        shm->take_len = pool->q_len;
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+        shm->taking = true;
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    }
+    task_t task = q_pop(pool);
+    if (pool->mode & POOL_SHM) {
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+        shm_of(pool)->taking = false;
+    }
+
+    if (task.function == NULL) {
+        struct pool_shm *shm = shm_of(pool);
+        struct pool_shm_slot *s = (struct pool_shm_slot *)((char *)shm + shm->slot_off) + slot;
+        struct pool_inline *in = bee->inline_buf + bee->yield_depth;
+        in->len = s->len;
+        memcpy(in->data, s->data, s->len);
+    }
+    trace(pool, bee->id, EV_DEQUEUE, task.function);
+    return task;
+}
+
+/*
+ * 일꾼 bee가 대기열에서 꺼낸 작업 task를 실행한다.
+ * 마감시각이 지난 작업은 실행하지 않고 expire로 알린 뒤 버린다.
+ * POOL_STATS이면 실행 통계를, POOL_TRACE이면 시작과 끝 사건을 함께 기록한다.
+ */
+static void run_task(pthread_bee_t *bee, task_t *task)
+{
+    pthread_pool_t *pool = bee->pool;
+
+    // 마감시각이 지난 작업은 실행하지 않고 expire 로 알린 뒤 버림 (26.10.19)
+    if (task->deadline != POOL_NODEADLINE && now_ns() > task->deadline) {
+        if (task->expire)
+            (*(task->expire))(task->param);
+        return;
+    }
+
+    void (*key)(void *) = task_key(pool, task);
+
+    // 대기열에서 기다리는 함수 실행, yield 에서 중첩될 수 있으므로 바깥 작업의 마감시각을 보존 (23.6.7)
+    // 작업이 쓴 임시 메모리는 끝나면 되돌림, 중첩된 작업은 자기가 쓴 만큼만 되돌림 (26.10.19)
+    uint64_t outer = bee->deadline;
+    size_t mark = bee->arena_top;
+    bee->deadline = task->deadline;
+    trace(pool, bee->id, EV_START, key);
+    if (!(pool->mode & POOL_STATS)) {
+        call_task(bee, task);
+        trace(pool, bee->id, EV_END, key);
+        bee->deadline = outer;
+        bee->arena_top = mark;
+        return;
+    }
+
+    // POOL_STATS 이면 대기 시간, 실행 시간, CPU 시간을 재서 기록 (26.10.19)
+    uint64_t start = now_ns(), cpu_start = cpu_ns();
+    call_task(bee, task);
+    uint64_t end = now_ns();
+    trace(pool, bee->id, EV_END, key);
+    stat_record(bee, key, start - task->submit, end - start, cpu_ns() - cpu_start);
+    bee->deadline = outer;
+    bee->arena_top = mark;
+}
+
+/*
+ * 작업 task를 실행하고, 그 작업이 일꾼의 next 자리에 맡긴 후속 작업이 있으면 이어서 실행한다.
+ * 후속 작업은 대기열을 거치지 않으므로 요청 시각은 맡겨진 시각으로 본다.
+ */
+static void run_chain(pthread_bee_t *bee, task_t *task)
+{
+    run_task(bee, task);
+    while (bee->has_next) {
+        task_t next = bee->next;
+        bee->has_next = false;
+        run_task(bee, &next);
+    }
+}
+
+/*
+ * 일꾼 bee가 yield 하는 동안 대기열의 맨 앞 작업 head를 대신 실행해도 되는지 판단한다.
+ * 짧다고 알려졌거나 더 급한 작업만 실행한다. 아무것도 모르는 작업을 실행하면 양보한 작업이
+ * 긴 작업 여러 개만큼 늦어질 수 있기 때문이다.
+ * POOL_EDF이면 지금 실행 중인 작업보다 마감시각이 이른 작업만 실행한다.
+ * POOL_STATS이면 이 일꾼이 재 본 평균 실행 시간이 YIELD_SHORT_NS보다 짧은 작업을 실행하고,
+ * POOL_EDF와 함께 쓰면 마감시각이 이르더라도 YIELD_SHORT_NS 이상인 긴 작업은 실행하지 않는다.
+ * 둘 다 아니면 판단할 근거가 없으므로 아무것도 실행하지 않는다.
+ */
+static bool yield_eligible(pthread_bee_t *bee, const task_t *head)
+{
+    bool earlier = (bee->pool->mode & POOL_EDF) && head->deadline < bee->deadline;
+
+    if ((bee->pool->mode & POOL_EDF) && !earlier)
+        return false;
+    if (bee->pool->mode & POOL_STATS) {
+        struct pool_stat_slot *e = stat_find(bee, task_key(bee->pool, head), false);
+        if (e != NULL) {
+            uint64_t count = atomic_load_explicit(&e->count, memory_order_relaxed);
+            if (count > 0)
+                return atomic_load_explicit(&e->run_ns, memory_order_relaxed) / count < YIELD_SHORT_NS;
+        }
+    }
+    return earlier;
+}
 
 /*
  * 풀에 있는 일꾼(일벌) 스레드가 수행할 함수이다.
@@ -18,39 +519,270 @@
  */
 static void *worker(void *param)
 {
-    // pool 주소 받아오기 (23.6.6)
-    pthread_pool_t *pool = (pthread_pool_t *)param;
+    // 일꾼 지역 정보와 pool 주소 받아오기 (23.6.6)
+    pthread_bee_t *bee = (pthread_bee_t *)param;
+    pthread_pool_t *pool = bee->pool;
 
+    self = bee;
     while (true) {
         // 상호배타 mutex 획득 (23.6.6)
-        pthread_mutex_lock(&(pool->mutex));
+        pool_lock(pool);
         
         // 대기열에 기다리는 함수가 있는지 확인 (23.6.7)
         while(pool->q_len == 0) {
             if (!pool->running) {
                 pthread_mutex_unlock(&(pool->mutex));
+                // POOL_PROC 의 자식은 부모에게서 물려받은 stdio 버퍼를 비우지 않고 끝냄 (26.10.19)
+                if (pool->mode & POOL_PROC)
+                    _exit(0);
                 pthread_exit(NULL);
             }
-            pthread_cond_wait(&(pool->full), &(pool->mutex));
+            trace(pool, bee->id, EV_PARK, NULL);
+            pool_wait(pool, &(pool->full));
+            trace(pool, bee->id, EV_WAKE, NULL);
         }
         
-        // 실행할 작업의 위치를 저장함 (23.6.8)
-        int to_exec = pool->q_front;
-        task_t task = pool->q[to_exec];
-
-        // 큐 인덱스 갱신 (23.6.8)
-        pool->q_front = (pool->q_front + 1) % pool->q_size;
-        pool->q_len--;
+        // 실행할 작업을 꺼내고 큐 인덱스 갱신 (23.6.8)
+        task_t task = q_take(bee);
         
         // 조건변수 시그널 및 뮤텍스 반환 (23.6.8)
         pthread_cond_signal(&(pool->empty));
         pthread_mutex_unlock(&(pool->mutex));
-    
-        // 대기열에서 기다리는 함수 실행 (23.6.7)
-        (*(task.function))(task.param);
+
+        run_chain(bee, &task);
     }
 }
 
+/*
+ * POOL_PROC 스레드풀에서 일꾼 하나를 맡는 감독 스레드가 수행할 함수이다.
+ * 자식 프로세스를 fork()해서 그 안에서 worker()를 실행하게 하고, 자식이 끝날 때까지 기다린다.
+ * 자식은 스레드풀이 종료되면 정상 종료하고, 작업을 실행하다 죽으면 비정상 종료한다.
+ * 비정상 종료이면 crashed를 늘리고, 아직 할 일이 남아 있으면 자식을 새로 만든다.
+ * 죽은 자식이 실행하던 작업은 잃어버리지만 대기열과 다른 일꾼은 영향을 받지 않는다.
+ * mutex를 쥔 채 죽었으면 다음에 mutex를 잡는 쪽이 pool_recover()로 대기열을 고친다.
+ */
+static void *supervisor(void *param)
+{
+    pthread_bee_t *bee = (pthread_bee_t *)param;
+    pthread_pool_t *pool = bee->pool;
+    int status;
+
+    while (true) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            // 자식 프로세스는 공유 메모리의 대기열을 보는 일꾼이 됨, 다시 만든 자식끼리 난수열이 겹치지 않게 함 (26.10.19)
+            rng_seed(bee->rng, now_ns() ^ ((uint64_t)getpid() << 32));
+            worker(bee);
+        }
+        if (pid == -1 || waitpid(pid, &status, 0) == -1)
+            break;
+        if (WIFEXITED(status) && WEXITSTATUS(status) == 0)
+            break;
+
+        // 비정상 종료한 자식을 세고, 남은 일이 있으면 다시 만듦 (26.10.19)
+        pool_lock(pool);
+        shm_of(pool)->crashed++;
+        bool done = !pool->running && pool->q_len == 0;
+        pthread_mutex_unlock(&(pool->mutex));
+        if (done)
+            break;
+    }
+    return NULL;
+}
+
+static void *spare(void *param);
+
+/*
+ * 막힌 일꾼이 일하는 예비 일꾼보다 많고 대기열에 작업이 있으면 예비 일꾼 하나를 일하게 한다.
+ * 쉬고 있는 예비 일꾼이 있으면 깨우고, 없으면 bee_size개까지 새로 만든다. mutex를 쥐고 불러야 한다.
+ */
+static void spare_activate(pthread_pool_t *pool)
+{
+    if (pool->blocked <= pool->spare_active || pool->q_len == 0)
+        return;
+
+    // 쉬는 예비 일꾼부터 깨움 (26.10.19)
+    if (pool->spare_size > pool->spare_active) {
+        pool->spare_wake++;
+        pool->spare_active++;
+        pthread_cond_signal(&(pool->spare));
+        return;
+    }
+    if (pool->spare_size == pool->bee_size)
+        return;
+
+    // 새 예비 일꾼의 지역 정보를 채운 뒤 만듦, 통계를 읽는 쪽이 볼 수 있도록 spare_size 는 나중에 늘림 (26.10.19)
+    pthread_bee_t *bee = pool->bee_ctx + pool->bee_size + 1 + pool->spare_size;
+    if ((pool->mode & POOL_STATS) && bee->stat == NULL &&
+        (bee->stat = (struct pool_stat_slot *)calloc(POOL_STATSIZE, sizeof(struct pool_stat_slot))) == NULL)
+        return;
+    if ((pool->mode & POOL_SHM) && bee->inline_buf == NULL &&
+        (bee->inline_buf = (struct pool_inline *)malloc(2 * sizeof(struct pool_inline))) == NULL)
+        return;
+    if (pthread_create(pool->bee + pool->bee_size + pool->spare_size, NULL, spare, bee) != 0)
+        return;
+    __atomic_store_n(&pool->spare_size, pool->spare_size + 1, __ATOMIC_RELEASE);
+    pool->spare_active++;
+}
+
+/*
+ * 예비 일꾼 스레드가 수행할 함수이다.
+ * 막힌 일꾼의 수가 일하는 예비 일꾼의 수보다 적어지거나 대기열이 비면 물러나서 쉬고,
+ * spare_activate()가 깨우면 다시 대기열의 작업을 꺼내 실행한다. 스레드풀이 종료되면 끝난다.
+ */
+static void *spare(void *param)
+{
+    pthread_bee_t *bee = (pthread_bee_t *)param;
+    pthread_pool_t *pool = bee->pool;
+
+    self = bee;
+    pool_lock(pool);
+    while (true) {
+        if (pool->q_len == 0 || pool->spare_active > pool->blocked) {
+            // 물러나서 깨울 때까지 쉼, 종료 중이면 끝냄 (26.10.19)
+            pool->spare_active--;
+            trace(pool, bee->id, EV_PARK, NULL);
+            while (pool->spare_wake == 0 && pool->running)
+                pool_wait(pool, &(pool->spare));
+            trace(pool, bee->id, EV_WAKE, NULL);
+            if (pool->spare_wake == 0)
+                break;
+            pool->spare_wake--;
+            continue;
+        }
+        task_t task = q_take(bee);
+        pthread_cond_signal(&(pool->empty));
+        pthread_mutex_unlock(&(pool->mutex));
+
+        run_chain(bee, &task);
+        pool_lock(pool);
+    }
+    pthread_mutex_unlock(&(pool->mutex));
+    return NULL;
+}
+
+/*
+ * 작업이 입출력이나 락처럼 오래 막힐 수 있는 구간에 들어가기 직전에 부른다.
+ * 막힌 일꾼 대신 대기열의 작업을 실행할 예비 일꾼을 필요하면 깨운다.
+ * 구간은 중첩할 수 있으며 가장 바깥 구간만 센다. 일꾼이 아닌 스레드나 POOL_PROC의 일꾼에서
+ * 부르면 아무것도 하지 않는다. 반드시 pthread_pool_blocking_end()와 짝을 맞춰야 한다.
+ */
+void pthread_pool_blocking_begin(void)
+{
+    pthread_bee_t *bee = self;
+
+    if (bee == NULL || (bee->pool->mode & POOL_PROC) || bee->blocking++ > 0)
+        return;
+
+    pthread_pool_t *pool = bee->pool;
+    pool_lock(pool);
+    pool->blocked++;
+    spare_activate(pool);
+    pthread_mutex_unlock(&(pool->mutex));
+}
+
+/*
+ * pthread_pool_blocking_begin()으로 들어간 구간을 끝낸다.
+ * 남는 예비 일꾼은 지금 실행 중인 작업을 마친 뒤 스스로 물러난다.
+ */
+void pthread_pool_blocking_end(void)
+{
+    pthread_bee_t *bee = self;
+
+    if (bee == NULL || (bee->pool->mode & POOL_PROC) || --bee->blocking > 0)
+        return;
+
+    pthread_pool_t *pool = bee->pool;
+    pool_lock(pool);
+    pool->blocked--;
+    pthread_mutex_unlock(&(pool->mutex));
+}
+
+/*
+ * 오래 걸리는 작업이 안전한 지점에서 부르는 협조적 양보 함수이다.
+ * 현재 일꾼의 대기열에 먼저 실행할 만한 작업이 있으면 최대 YIELD_BATCH개를 이 자리에서 대신 실행하고
+ * 돌아온다. 선점 없이도 긴 작업 뒤에 줄 선 짧은 작업이나 급한 작업의 대기 시간을 제한하기 위함이다.
+ * 어떤 작업을 대신 실행할지는 yield_eligible()이 정하므로 POOL_EDF나 POOL_STATS가 없으면 아무것도 하지 않는다.
+ * 대신 실행된 작업 안에서 다시 부르거나 일꾼이 아닌 스레드에서 부르면 아무것도 하지 않는다.
+ * 대신 실행한 작업의 수를 리턴한다.
+ * POOL_STATS에서 양보한 작업의 실행 시간에는 대신 실행한 작업의 시간도 포함된다.
+ */
+int pthread_pool_yield(void)
+{
+    pthread_bee_t *bee = self;
+    int ran = 0;
+
+    if (bee == NULL || bee->yield_depth > 0)
+        return 0;
+
+    // 락 없이 대기열이 비었는지 먼저 확인해서 흔한 경우를 싸게 처리함 (26.10.19)
+    pthread_pool_t *pool = bee->pool;
+    if (__atomic_load_n(&pool->q_len, __ATOMIC_RELAXED) == 0)
+        return 0;
+
+    bee->yield_depth++;
+    while (ran < YIELD_BATCH) {
+        pool_lock(pool);
+        if (pool->q_len == 0 || !yield_eligible(bee, pool->q + ((pool->mode & POOL_EDF) ? 0 : pool->q_front))) {
+            pthread_mutex_unlock(&(pool->mutex));
+            break;
+        }
+        task_t task = q_take(bee);
+        pthread_cond_signal(&(pool->empty));
+        pthread_mutex_unlock(&(pool->mutex));
+
+        run_chain(bee, &task);
+        ran++;
+    }
+    bee->yield_depth--;
+    return ran;
+}
+
+/*
+ * 현재 스레드가 일꾼이면 그 일꾼의 지역 정보를, 아니면 NULL을 리턴한다.
+ * 작업은 id로 일꾼별 자료를 나눠 쓰면 공유 자료를 락 없이 다룰 수 있다.
+ */
+pthread_bee_t *pthread_pool_self(void)
+{
+    return self;
+}
+
+/*
+ * 지금 실행 중인 작업이 쓸 임시 메모리를 size 바이트만큼 일꾼의 arena에서 잘라서 리턴한다.
+ * 돌려받은 메모리는 작업이 끝나면 저절로 반납되므로 free()하면 안 되고 작업 밖으로 넘겨도 안 된다.
+ * 일꾼이 아닌 스레드에서 부르거나 arena에 남은 자리가 모자라면 NULL을 리턴한다.
+ */
+void *pthread_pool_scratch(size_t size)
+{
+    pthread_bee_t *bee = self;
+
+    if (bee == NULL)
+        return NULL;
+    if (bee->arena == NULL && (bee->arena = (char *)malloc(POOL_ARENASIZE)) == NULL)
+        return NULL;
+
+    size_t top = (bee->arena_top + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    if (size > POOL_ARENASIZE - top)
+        return NULL;
+    bee->arena_top = top + size;
+    return bee->arena + top;
+}
+
+/*
+ * 64비트 난수를 리턴한다. 일꾼마다 따로 둔 xoshiro256** 상태를 쓰므로 rand()처럼
+ * 전역 락을 잡지 않는다. 일꾼이 아닌 스레드에서 부르면 그 스레드의 지역 상태를 쓴다.
+ */
+uint64_t pthread_pool_rand(void)
+{
+    if (self != NULL)
+        return rng_next(self->rng);
+    if (!local_rng_seeded) {
+        rng_seed(local_rng, now_ns() ^ (uint64_t)(uintptr_t)&local_rng);
+        local_rng_seeded = true;
+    }
+    return rng_next(local_rng);
+}
+
 /*
  * 스레드풀을 생성한다. bee_size는 일꾼(일벌) 스레드의 개수이고, queue_size는 대기열의 용량이다.
  * bee_size는 POOL_MAXBSIZE를, queue_size는 POOL_MAXQSIZE를 넘을 수 없다.
@@ -62,26 +794,43 @@ static void *worker(void *param)
  * 성공하면 POOL_SUCCESS를, 실패하면 POOL_FAIL을 리턴한다.
  */
 int pthread_pool_init(pthread_pool_t *pool, size_t bee_size, size_t queue_size)
+{
+    return pthread_pool_init_mode(pool, bee_size, queue_size, POOL_FIFO);
+}
+
+/*
+ * pthread_pool_init()과 같지만 대기열의 정렬 방식 mode를 지정할 수 있다.
+ * POOL_FIFO이면 들어온 순서대로, POOL_EDF이면 마감시각이 가장 이른 작업부터 실행한다.
+ * POOL_EDF에서 마감시각이 없는 작업은 마감시각이 있는 모든 작업 뒤에 들어온 순서대로 실행된다.
+ */
+int pthread_pool_init_mode(pthread_pool_t *pool, size_t bee_size, size_t queue_size, int mode)
 {
     // pool 조건 확인 (23.6.6)
     if (bee_size > POOL_MAXBSIZE || queue_size > POOL_MAXQSIZE)
         return POOL_FAIL;
+    if (mode & ~(POOL_EDF | POOL_STATS | POOL_TRACE))
+        return POOL_FAIL;
     
     // bee_size > queue_size 인 상황에서의 queue_size 상향 (23.6.6)
     queue_size = MAX(bee_size, queue_size);
 
-    // pool 변수 초기화 및 할당 (23.6.6)
-    pthread_pool_t *pool_p;
-    if((pool_p = (pthread_pool_t *)malloc(sizeof(pthread_pool_t))) == NULL) {
-        return POOL_FAIL;
-    }
-    *pool = *pool_p;
+    return pool_init(pool, bee_size, queue_size, mode, NULL);
+}
+
+/*
+ * 검사를 마친 인자로 스레드풀 pool을 실제로 초기화하고 일꾼 스레드를 만든다.
+ * q가 NULL이면 대기열을 새로 할당하고, 아니면 주어진 공간(POOL_SHM의 공유 메모리)을 쓴다.
+ * POOL_SHM이면 상호배타 락과 조건 변수를 프로세스 간 공유 속성으로 초기화한다.
+ */
+static int pool_init(pthread_pool_t *pool, size_t bee_size, size_t queue_size, int mode, task_t *q)
+{
+    // 모든 필드를 아래에서 채우므로 따로 할당해서 복사하지 않음, 예전 방식은 복사한 블록이 새어 나갔음 (26.10.19)
     
     // 스레드풀의 실행 또는 종료 상태
     pool->running = true;
     
     // FIFO 작업 대기열로 사용할 원형 버퍼
-    if((pool->q = (task_t *)malloc(sizeof(task_t) * queue_size)) == NULL) {
+    if((pool->q = q) == NULL && (pool->q = (task_t *)malloc(sizeof(task_t) * queue_size)) == NULL) {
         return POOL_FAIL;
     } 
     
@@ -91,24 +840,76 @@ int pthread_pool_init(pthread_pool_t *pool, size_t bee_size, size_t queue_size)
     pool->q_front = 0;
     // 대기열의 길이
     pool->q_len = 0;
+    // 대기열 정렬 방식과 작업 일련번호
+    pool->mode = mode;
+    pool->q_seq = 0;
 
     // 일꾼(일벌) 스레드의 ID를 저장하기 위한 배열
-    if((pool->bee = (pthread_t *)malloc(sizeof(pthread_t) * bee_size)) == NULL) {
+    // 뒤쪽 절반은 예비 일꾼의 몫 (26.10.19)
+    if((pool->bee = (pthread_t *)malloc(sizeof(pthread_t) * MAX(2 * bee_size, 1))) == NULL) {
         return POOL_FAIL;
     }
     
     // bee 배열의 크기로 일꾼 스레드의 수를 의미
     pool->bee_size = bee_size;
+
+    // 일꾼, 빈 자리 하나, 예비 일꾼 순의 지역 정보, POOL_STATS 이면 일꾼의 통계 표도 할당 (26.10.19)
+    pool->blocked = 0;
+    pool->spare_size = 0;
+    pool->spare_active = 0;
+    pool->spare_wake = 0;
+    if((pool->bee_ctx = (pthread_bee_t *)calloc(2 * bee_size + 1, sizeof(pthread_bee_t))) == NULL) {
+        return POOL_FAIL;
+    }
+    // POOL_TRACE 이면 일꾼별 링 버퍼와 외부 요청용 링 버퍼 하나, 예비 일꾼별 링 버퍼를 할당 (26.10.19)
+    pool->trace = NULL;
+    pool->trace_t0 = now_ns();
+    if((mode & POOL_TRACE) &&
+       (pool->trace = (struct pool_trace_ring *)calloc(2 * bee_size + 1, sizeof(struct pool_trace_ring))) == NULL) {
+        return POOL_FAIL;
+    }
+    // POOL_SHM 이면 작업 종류 번호별 함수 표는 pthread_pool_shm_create() 가 공유 메모리에 잡음 (26.10.19)
+    pool->types = NULL;
+    for(int i = 0; i < 2 * bee_size + 1; i++) {
+        pool->bee_ctx[i].pool = pool;
+        pool->bee_ctx[i].id = i;
+        rng_seed(pool->bee_ctx[i].rng, pool->trace_t0 ^ ((uint64_t)(uintptr_t)pool << 16) ^ (uint64_t)i);
+        if(i >= bee_size)
+            continue;
+        if((mode & POOL_STATS) &&
+           (pool->bee_ctx[i].stat = (struct pool_stat_slot *)calloc(POOL_STATSIZE, sizeof(struct pool_stat_slot))) == NULL) {
+            return POOL_FAIL;
+        }
+        if((mode & POOL_SHM) &&
+           (pool->bee_ctx[i].inline_buf = (struct pool_inline *)malloc(2 * sizeof(struct pool_inline))) == NULL) {
+            return POOL_FAIL;
+        }
+    }
+    // POOL_SHM 이면 다른 프로세스와 공유할 수 있는 속성을 씀 (26.10.19)
+    pthread_mutexattr_t mattr;
+    pthread_condattr_t cattr;
+    pthread_mutexattr_init(&mattr);
+    pthread_condattr_init(&cattr);
+    if (mode & POOL_SHM) {
+        pthread_mutexattr_setpshared(&mattr, PTHREAD_PROCESS_SHARED);
+        pthread_condattr_setpshared(&cattr, PTHREAD_PROCESS_SHARED);
+        // mutex 를 쥔 프로세스가 죽어도 넘겨받을 수 있게 함, POOL_PROC 의 자식은 언제든 죽을 수 있음 (26.10.19)
+        pthread_mutexattr_setrobust(&mattr, PTHREAD_MUTEX_ROBUST);
+    }
     // 대기열을 접근하기 위해 사용되는 상호배타 락
-    pthread_mutex_init(&(pool->mutex), NULL);
+    pthread_mutex_init(&(pool->mutex), &mattr);
     // 빈 대기열에 새 작업이 들어올 때까지 기다리는 곳
-    pthread_cond_init(&(pool->full), NULL);
+    pthread_cond_init(&(pool->full), &cattr);
     // 대기열에 빈 자리가 발생할 때까지 기다리는 곳
-    pthread_cond_init(&(pool->empty), NULL);
+    pthread_cond_init(&(pool->empty), &cattr);
+    // 쉬는 예비 일꾼이 깨울 때까지 기다리는 곳
+    pthread_cond_init(&(pool->spare), &cattr);
+    pthread_mutexattr_destroy(&mattr);
+    pthread_condattr_destroy(&cattr);
     
     // worker 함수 할당 (23.6.6)
     for(int i = 0; i < bee_size; i++) {
-        pthread_create(pool->bee + i, NULL, worker, pool); // pool pointer 전달
+        pthread_create(pool->bee + i, NULL, (mode & POOL_PROC) ? supervisor : worker, pool->bee_ctx + i); // 일꾼 지역 정보 전달
     }
     
     // pool 생성 성공 시 POOL_SUCCESS 반환 (23.6.6)
@@ -116,29 +917,29 @@ int pthread_pool_init(pthread_pool_t *pool, size_t bee_size, size_t queue_size)
 }
 
 /*
- * 스레드풀에서 실행시킬 함수와 인자의 주소를 넘겨주며 작업을 요청한다.
- * 스레드풀의 대기열이 꽉 찬 상황에서 flag이 POOL_NOWAIT이면 즉시 POOL_FULL을 리턴한다.
+ * 작업 task를 대기열에 넣는다. pthread_pool_submit()과 pthread_pool_submit_deadline()이 공유한다.
+ * 대기열이 꽉 찬 상황에서 flag이 POOL_NOWAIT이면 즉시 POOL_FULL을 리턴한다.
  * POOL_WAIT이면 대기열에 빈 자리가 나올 때까지 기다렸다가 넣고 나온다.
- * 작업 요청이 성공하면 POOL_SUCCESS를 리턴한다.
  */
-int pthread_pool_submit(pthread_pool_t *pool, void (*f)(void *p), void *p, int flag)
+static int enqueue(pthread_pool_t *pool, task_t *task, int flag)
 {
-    /* (23.6.6)
-     * pool : 스레드풀 포인터
-     * f : void* 를 매개변수로 받는 함수
-     * p : 함수에 입력된 매개변수
-     * flag : POOL_NOWAIT 또는 POOL_WAIT 옵션
-     */
+    // POOL_PROC 의 자식 프로세스는 인자 주소를 따라갈 수 없으므로 거절 (26.10.19)
+    if (pool->mode & POOL_PROC)
+        return POOL_FAIL;
+
+    // POOL_STATS 이면 대기 시간을 재기 위해 요청 시각을 기록 (26.10.19)
+    if (pool->mode & POOL_STATS)
+        task->submit = now_ns();
 
     // 상호배제 mutex 획득 (23.6.8)
-    pthread_mutex_lock(&(pool->mutex));
+    pool_lock(pool);
     
     // 다음 조건이 모두 성립할 때, 조건변수를 바탕으로 대기함 (23.6.8)
     // 1. 큐가 가득 찼음
     // 2. pool 이 running 상태임
     // 3. POOL_WAIT 옵션임
     while (pool->q_len == pool->q_size && pool->running && flag == POOL_WAIT) {
-        pthread_cond_wait(&(pool->empty), &(pool->mutex));
+        pool_wait(pool, &(pool->empty));
     }
 
     // pool 이 running 상태가 아닌 경우  POOL_FAIL 반환
@@ -153,15 +954,14 @@ int pthread_pool_submit(pthread_pool_t *pool, void (*f)(void *p), void *p, int f
         return POOL_FULL;
     }
 
-    // 대기열 빈 자리 인덱스 저장 공간 (23.6.8)
-    int index = (pool->q_front + pool->q_len) % pool->q_size;
-
-    // 넣을 공간을 찾았다면 그대로 집어넣기 (23.6.8)
-    pool->q[index].function = f;
-    pool->q[index].param = p;
-    pool->q_len++;
+    // 넣을 공간을 찾았다면 일련번호를 매겨 그대로 집어넣기 (23.6.8)
+    task->seq = pool->q_seq++;
+    q_push(pool, task);
+    trace(pool, self && self->pool == pool ? self->id : pool->bee_size, EV_SUBMIT, task->function);
 
     pthread_cond_signal(&(pool->full));
+    // 막힌 일꾼이 있으면 대신 일할 예비 일꾼을 깨움 (26.10.19)
+    spare_activate(pool);
 
     // 상호배제 mutex 반환 (23.6.8)
     pthread_mutex_unlock(&(pool->mutex));
@@ -169,10 +969,226 @@ int pthread_pool_submit(pthread_pool_t *pool, void (*f)(void *p), void *p, int f
     return POOL_SUCCESS;
 }
 
+/*
+ * 스레드풀에서 실행시킬 함수와 인자의 주소를 넘겨주며 작업을 요청한다.
+ * 스레드풀의 대기열이 꽉 찬 상황에서 flag이 POOL_NOWAIT이면 즉시 POOL_FULL을 리턴한다.
+ * POOL_WAIT이면 대기열에 빈 자리가 나올 때까지 기다렸다가 넣고 나온다.
+ * 작업 요청이 성공하면 POOL_SUCCESS를 리턴한다.
+ */
+int pthread_pool_submit(pthread_pool_t *pool, void (*f)(void *p), void *p, int flag)
+{
+    /* (23.6.6)
+     * pool : 스레드풀 포인터
+     * f : void* 를 매개변수로 받는 함수
+     * p : 함수에 입력된 매개변수
+     * flag : POOL_NOWAIT 또는 POOL_WAIT 옵션
+     */
+    task_t task = { f, p, NULL, POOL_NODEADLINE, 0, 0 };
+
+    return enqueue(pool, &task, flag);
+}
+
+/*
+ * pthread_pool_submit()과 같지만 CLOCK_MONOTONIC 기준의 절대 마감시각 deadline을 함께 넘긴다.
+ * POOL_EDF 스레드풀은 마감시각이 이른 작업부터 실행한다.
+ * 일꾼 스레드가 작업을 꺼냈을 때 이미 마감시각이 지났으면 f를 실행하지 않고,
+ * expire가 NULL이 아니면 expire(p)를 대신 호출해서 작업이 버려졌음을 알린다.
+ * deadline이 NULL이면 마감시각이 없으며, 이때도 POOL_DISCARD 종료로 버려지면 expire(p)가 불린다.
+ */
+int pthread_pool_submit_deadline(pthread_pool_t *pool, void (*f)(void *p), void *p,
+                                 const struct timespec *deadline, void (*expire)(void *p), int flag)
+{
+    task_t task = { f, p, expire, POOL_NODEADLINE, 0, 0 };
+
+    // 마감시각을 ns 단위로 바꾸어 저장 (26.10.19)
+    if (deadline != NULL)
+        task.deadline = (uint64_t)deadline->tv_sec * 1000000000ULL + deadline->tv_nsec;
+
+    return enqueue(pool, &task, flag);
+}
+
+/*
+ * 핸들 t의 참조 하나를 반납하고, 남은 참조가 없으면 핸들을 해제한다.
+ */
+static void task_unref(pool_task_t *t)
+{
+    if (atomic_fetch_sub(&t->ref, 1) == 1)
+        free(t);
+}
+
+/*
+ * 실행되지 못하고 버려지는 핸들 t를 끝난 것으로 표시하고, 등록된 후속 작업도 모두 취소한다.
+ * 스레드풀이 가진 참조를 반납한다.
+ */
+static void task_cancel(pool_task_t *t)
+{
+    pool_task_t *c = atomic_exchange(&t->then, TASK_DONE);
+
+    while (c != NULL) {
+        pool_task_t *sibling = c->sibling;
+        task_cancel(c);
+        c = sibling;
+    }
+    task_unref(t);
+}
+
+/*
+ * 선행 작업이 끝나서 실행할 수 있게 된 후속 작업 c를 내보낸다.
+ * 일꾼이 부르고 last가 참이며 대기열이 비어 있으면(일꾼이 곧 놀게 되면) 대기열을 거치지 않고
+ * 일꾼의 next 자리에 맡겨서 같은 일꾼이 곧바로 실행하게 한다. 그 밖에는 대기열에 넣는다.
+ * 일꾼이 대기열에 넣을 때는 교착을 피하려고 기다리지 않으며, 꽉 찼으면 역시 next 자리로 보낸다.
+ * next 자리마저 차 있으면 그 자리에서 바로 실행한다. 스레드풀이 종료 중이면 후속 작업을 취소한다.
+ */
+static void task_dispatch(pool_task_t *c, bool last)
+{
+    pthread_pool_t *pool = c->pool;
+    pthread_bee_t *bee = (self != NULL && self->pool == pool) ? self : NULL;
+    task_t task = { run_handle, c, NULL, POOL_NODEADLINE, 0, 0 };
+
+    if (bee != NULL && !bee->has_next && last && __atomic_load_n(&pool->q_len, __ATOMIC_RELAXED) == 0) {
+        task.submit = now_ns();
+        bee->next = task;
+        bee->has_next = true;
+        return;
+    }
+
+    switch (enqueue(pool, &task, bee != NULL ? POOL_NOWAIT : POOL_WAIT)) {
+        case POOL_SUCCESS:
+            return;
+        case POOL_FULL:
+            task.submit = now_ns();
+            if (!bee->has_next) {
+                bee->next = task;
+                bee->has_next = true;
+            } else {
+                run_task(bee, &task);
+            }
+            return;
+        default:
+            task_cancel(c);
+    }
+}
+
+/*
+ * 핸들로 요청한 작업을 실행하는 함수로, 대기열에는 run_handle(핸들)로 들어간다.
+ * 작업을 실행한 뒤 then을 TASK_DONE으로 바꾸어 더 이상의 등록을 막고, 등록된 후속 작업을
+ * 등록 순서대로 내보낸다. 마지막 후속 작업만 같은 일꾼이 곧바로 이어받을 수 있다.
+ */
+static void run_handle(void *param)
+{
+    pool_task_t *t = (pool_task_t *)param;
+
+    (*(t->function))(t->param);
+
+    // 스택으로 쌓인 후속 작업을 뒤집어서 등록 순서로 만듦 (26.10.19)
+    pool_task_t *c = atomic_exchange(&t->then, TASK_DONE), *order = NULL;
+    while (c != NULL) {
+        pool_task_t *sibling = c->sibling;
+        c->sibling = order;
+        order = c;
+        c = sibling;
+    }
+    while (order != NULL) {
+        pool_task_t *sibling = order->sibling;
+        task_dispatch(order, sibling == NULL);
+        order = sibling;
+    }
+    task_unref(t);
+}
+
+/*
+ * 핸들을 하나 만든다. 사용자에게 돌려줄 핸들이면 사용자 몫의 참조를 하나 더 센다.
+ */
+static pool_task_t *task_new(pthread_pool_t *pool, void (*f)(void *p), void *p, bool user)
+{
+    pool_task_t *t;
+
+    if ((t = (pool_task_t *)malloc(sizeof(pool_task_t))) == NULL)
+        return NULL;
+    t->pool = pool;
+    t->function = f;
+    t->param = p;
+    t->sibling = NULL;
+    atomic_init(&t->then, NULL);
+    atomic_init(&t->ref, user ? 2 : 1);
+    return t;
+}
+
+/*
+ * pthread_pool_submit()과 같지만 요청한 작업의 핸들을 *handle에 돌려준다.
+ * 핸들에는 pthread_pool_then()으로 후속 작업을 이어 붙일 수 있다. handle이 NULL이면 핸들을 돌려주지 않는다.
+ * 요청이 실패하면 *handle은 NULL이다. 돌려받은 핸들은 다 쓰고 나서 pthread_pool_task_release()로 반납한다.
+ */
+int pthread_pool_submit_task(pthread_pool_t *pool, void (*f)(void *p), void *p, int flag, pool_task_t **handle)
+{
+    pool_task_t *t;
+    int result;
+
+    if (handle != NULL)
+        *handle = NULL;
+    if ((t = task_new(pool, f, p, handle != NULL)) == NULL)
+        return POOL_FAIL;
+
+    task_t task = { run_handle, t, NULL, POOL_NODEADLINE, 0, 0 };
+    if ((result = enqueue(pool, &task, flag)) != POOL_SUCCESS) {
+        free(t);
+        return result;
+    }
+    if (handle != NULL)
+        *handle = t;
+    return POOL_SUCCESS;
+}
+
+/*
+ * 핸들 t의 작업이 끝나면 실행할 후속 작업 f(p)를 등록하고, 후속 작업의 핸들을 *handle에 돌려준다.
+ * 후속 작업은 선행 작업을 마친 일꾼이 달리 할 일이 없으면 대기열을 거치지 않고 곧바로 실행한다.
+ * 한 핸들에 여러 후속 작업을 등록할 수 있으며 등록 순서대로 내보낸다.
+ * t가 이미 끝났으면 후속 작업을 곧바로 대기열에 넣는다. 스레드풀을 종료하기 전에만 부를 수 있다.
+ * 선행 작업이 POOL_DISCARD로 버려지거나, 종료가 시작된 뒤 대기열로 가야 하는 후속 작업은 실행되지 않는다.
+ */
+int pthread_pool_then(pool_task_t *t, void (*f)(void *p), void *p, pool_task_t **handle)
+{
+    pool_task_t *c;
+
+    if (handle != NULL)
+        *handle = NULL;
+    if ((c = task_new(t->pool, f, p, handle != NULL)) == NULL)
+        return POOL_FAIL;
+    if (handle != NULL)
+        *handle = c;
+
+    // 아직 끝나지 않았으면 후속 작업 스택에 CAS 로 밀어 넣음 (26.10.19)
+    pool_task_t *head = atomic_load(&t->then);
+    while (head != TASK_DONE) {
+        c->sibling = head;
+        if (atomic_compare_exchange_weak(&t->then, &head, c))
+            return POOL_SUCCESS;
+    }
+    task_dispatch(c, true);
+    return POOL_SUCCESS;
+}
+
+/*
+ * 핸들 t의 작업이 끝났거나 버려졌으면 참을 리턴한다.
+ */
+bool pthread_pool_task_done(pool_task_t *t)
+{
+    return atomic_load(&t->then) == TASK_DONE;
+}
+
+/*
+ * 사용자가 가진 핸들 t를 반납한다. 작업이 아직 끝나지 않았어도 작업과 후속 작업은 그대로 진행된다.
+ */
+void pthread_pool_task_release(pool_task_t *t)
+{
+    task_unref(t);
+}
+
 /*
  * 스레드풀을 종료한다. 일꾼 스레드가 현재 작업 중이면 그 작업을 마치게 한다.
  * how의 값이 POOL_COMPLETE이면 대기열에 남아 있는 모든 작업을 마치고 종료한다.
  * POOL_DISCARD이면 대기열에 새 작업이 남아 있어도 더 이상 수행하지 않고 종료한다.
+ * 버려지는 작업에 expire가 있으면 락을 놓은 뒤, 일꾼과 조인하기 전에 expire(p)를 불러 알린다.
  * 부모 스레드는 종료된 일꾼 스레드와 조인한 후에 스레드풀에 할당된 자원을 반납한다.
  * 스레드를 종료시키기 위해 철회를 생각할 수 있으나 바람직하지 않다.
  * 락을 소유한 스레드를 중간에 철회하면 교착상태가 발생하기 쉽기 때문이다.
@@ -180,8 +1196,10 @@ int pthread_pool_submit(pthread_pool_t *pool, void (*f)(void *p), void *p, int f
  */
 int pthread_pool_shutdown(pthread_pool_t *pool, int how)
 {
+    int front = 0, ndrop = 0;
+
     // 상호배제 mutex 획득 (23.6.8)
-    pthread_mutex_lock(&(pool->mutex));
+    pool_lock(pool);
 
     // 더 이상의 요청을 받지 않음.
     pool->running = false;
@@ -190,6 +1208,9 @@ int pthread_pool_shutdown(pthread_pool_t *pool, int how)
     switch (how) {
         case POOL_DISCARD:
             // 대기열 모두 삭제 (23.6.8)
+            // 버린 작업은 자리에 그대로 두고 락을 놓은 뒤 처리함, 새 작업은 더 들어오지 않음 (26.10.19)
+            front = (pool->mode & POOL_EDF) ? 0 : pool->q_front;
+            ndrop = pool->q_len;
             pool->q_len = 0;
             break;
             
@@ -200,21 +1221,361 @@ int pthread_pool_shutdown(pthread_pool_t *pool, int how)
     // 종료할 스레드는 모두 종료시키도록 신호를 보냄 (23.6.8)
     pthread_cond_broadcast(&(pool->full));
     pthread_cond_broadcast(&(pool->empty));
+    pthread_cond_broadcast(&(pool->spare));
 
     // 상호배제 mutex 반환 (23.6.8)
     pthread_mutex_unlock(&(pool->mutex));
+
+    // 핸들로 요청한 작업은 후속 작업까지 취소하고 반납 (23.6.8)
+    // 마감시각이 지난 작업처럼 expire 가 있으면 버려졌음을 알림 (26.10.19)
+    // expire 가 스레드풀 함수를 부르거나 스레드풀에 요청하며 쥐는 락을 잡아도 되도록 락 밖에서 부름
+    for (int i = 0; i < ndrop; i++) {
+        task_t *task = pool->q + (front + i) % pool->q_size;
+        if (task->function == run_handle)
+            task_cancel((pool_task_t *)task->param);
+        else if (task->expire)
+            (*(task->expire))(task->param);
+    }
     
     // 종료한 스레드들 join 진행 (23.6.8)
     for(int i = 0; i < pool->bee_size; i++) {
         pthread_join(pool->bee[i], NULL);
     }
+    // 일꾼이 모두 끝나면 대기열이 비어 예비 일꾼이 더 생기지 않으므로 지금까지 만든 것만 join (26.10.19)
+    for(int i = 0; i < pool->spare_size; i++) {
+        pthread_join(pool->bee[pool->bee_size + i], NULL);
+    }
 
     // 스레드풀 메모리 및 뮤텍스, 조건변수 할당 해제 (23.6.8)
+    for(int i = 0; i < 2 * pool->bee_size + 1; i++) {
+        free(pool->bee_ctx[i].stat);
+        free(pool->bee_ctx[i].inline_buf);
+        free(pool->bee_ctx[i].arena);
+    }
+    free(pool->bee_ctx);
+    free(pool->trace);
     free(pool->bee);
-    free(pool->q);
+    pthread_cond_destroy(&(pool->spare));
     pthread_cond_destroy(&(pool->empty));
     pthread_cond_destroy(&(pool->full));
     pthread_mutex_destroy(&(pool->mutex));
 
+    // POOL_SHM 이면 대기열을 포함한 공유 메모리 영역을 지우고 떼어냄 (26.10.19)
+    if (pool->mode & POOL_SHM) {
+        struct pool_shm *shm = shm_of(pool);
+        shm_unlink(shm->name);
+        munmap(shm, shm->map_size);
+    } else {
+        free(pool->q);
+    }
+
     return POOL_SUCCESS;
 }
+
+/*
+ * 이름이 name인 공유 메모리 영역에 제어블록과 대기열을 두는 POOL_SHM 스레드풀을 만들어서 돌려준다.
+ * name은 shm_open()의 규칙대로 '/'로 시작해야 하며 같은 이름의 영역이 이미 있으면 실패한다.
+ * 이 프로세스 안에서는 돌려받은 포인터로 지금까지의 API를 그대로 쓸 수 있고,
+ * 다른 프로세스는 pthread_pool_shm_open()으로 붙은 뒤 pthread_pool_submit_inline()으로
+ * 작업 종류 번호와 인자 내용을 넘겨 작업을 요청한다. 대기열은 FIFO로만 동작한다.
+ * 종료는 pthread_pool_shutdown()으로 하며 이때 공유 메모리 영역도 지워진다. 실패하면 NULL을 리턴한다.
+ */
+pthread_pool_t *pthread_pool_shm_create(const char *name, size_t bee_size, size_t queue_size)
+{
+    return shm_create(name, bee_size, queue_size, POOL_SHM);
+}
+
+/*
+ * 이름이 name인 공유 메모리 영역에 POOL_PROC 스레드풀을 만들어서 돌려준다.
+ * 일꾼은 스레드 대신 proc_size개의 자식 프로세스이며, 작업 함수가 죽어도 스레드풀을 만든 프로세스는
+ * 살아남고 죽은 일꾼은 다시 만들어진다. 작업은 작업마다 fork()나 파이프 쓰기 없이 공유 메모리 대기열로
+ * 넘기므로 pthread_pool_submit_inline()으로만 요청할 수 있다. 자식이 인자 주소를 따라가서 부모의
+ * 메모리를 볼 수는 없기 때문이다. 작업 종류 번호별 함수는 pthread_pool_shm_register()로 등록하며,
+ * 등록은 공유 메모리에 기록되므로 자식이 만들어진 뒤에 해도 된다. 실패하면 NULL을 리턴한다.
+ */
+pthread_pool_t *pthread_pool_proc_create(const char *name, size_t proc_size, size_t queue_size)
+{
+    return shm_create(name, proc_size, queue_size, POOL_SHM | POOL_PROC);
+}
+
+/*
+ * POOL_PROC 스레드풀 pool에서 지금까지 비정상 종료한 일꾼 프로세스의 수를 리턴한다.
+ */
+int pthread_pool_proc_crashed(pthread_pool_t *pool)
+{
+    int crashed;
+
+    if (!(pool->mode & POOL_PROC))
+        return 0;
+    pool_lock(pool);
+    crashed = shm_of(pool)->crashed;
+    pthread_mutex_unlock(&(pool->mutex));
+    return crashed;
+}
+
+/*
+ * pthread_pool_shm_create()와 pthread_pool_proc_create()가 공유하는 부분으로,
+ * 공유 메모리 영역을 만들어 mode로 스레드풀을 초기화한다.
+ */
+static pthread_pool_t *shm_create(const char *name, size_t bee_size, size_t queue_size, int mode)
+{
+    struct pool_shm *shm;
+    int fd;
+
+    if (strlen(name) >= POOL_SHM_NAMELEN || bee_size > POOL_MAXBSIZE || queue_size > POOL_MAXQSIZE)
+        return NULL;
+    queue_size = MAX(bee_size, queue_size);
+
+    // 머리, 대기열, 인자 내용 칸 순으로 영역 크기를 정함 (26.10.19)
+    size_t q_off = (sizeof(struct pool_shm) + 63) & ~(size_t)63;
+    size_t slot_off = q_off + sizeof(task_t) * queue_size;
+    size_t map_size = slot_off + sizeof(struct pool_shm_slot) * queue_size;
+
+    if ((fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600)) == -1)
+        return NULL;
+    if (ftruncate(fd, map_size) == -1 ||
+        (shm = (struct pool_shm *)mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+        close(fd);
+        shm_unlink(name);
+        return NULL;
+    }
+    close(fd);
+
+    shm->map_size = map_size;
+    shm->q_off = q_off;
+    shm->slot_off = slot_off;
+    strcpy(shm->name, name);
+    if (pool_init(&shm->pool, bee_size, queue_size, mode, (task_t *)((char *)shm + q_off)) != POOL_SUCCESS) {
+        munmap(shm, map_size);
+        shm_unlink(name);
+        return NULL;
+    }
+    // 이 스레드풀의 요청은 아직 받을 수 없으므로 일꾼이 함수 표를 보기 전에 연결해도 됨
+    shm->pool.types = shm->types;
+    atomic_store(&shm->magic, SHM_MAGIC);
+    return &shm->pool;
+}
+
+/*
+ * 다른 프로세스가 만든 이름이 name인 POOL_SHM 스레드풀에 붙어서 이 프로세스에서의 주소를 돌려준다.
+ * 돌려받은 포인터로는 pthread_pool_submit_inline()과 pthread_pool_shm_close()만 부를 수 있다.
+ * 스레드풀을 만든 프로세스가 종료하기 전에 떼어내야 한다. 실패하면 NULL을 리턴한다.
+ */
+pthread_pool_t *pthread_pool_shm_open(const char *name)
+{
+    struct pool_shm *shm;
+    struct stat st;
+    int fd;
+
+    if ((fd = shm_open(name, O_RDWR, 0)) == -1)
+        return NULL;
+    if (fstat(fd, &st) == -1 || st.st_size < sizeof(struct pool_shm) ||
+        (shm = (struct pool_shm *)mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+    close(fd);
+
+    // 초기화를 마친 영역인지 확인 (26.10.19)
+    if (atomic_load(&shm->magic) != SHM_MAGIC || shm->map_size != st.st_size) {
+        munmap(shm, st.st_size);
+        return NULL;
+    }
+    return &shm->pool;
+}
+
+/*
+ * pthread_pool_shm_open()으로 붙었던 스레드풀 pool에서 떼어낸다. 스레드풀은 그대로 동작한다.
+ */
+int pthread_pool_shm_close(pthread_pool_t *pool)
+{
+    struct pool_shm *shm = shm_of(pool);
+
+    return munmap(shm, shm->map_size) == 0 ? POOL_SUCCESS : POOL_FAIL;
+}
+
+/*
+ * POOL_SHM 스레드풀 pool에 작업 종류 번호 type의 함수 f를 등록한다.
+ * 종류 번호로 요청한 작업은 일꾼이 f(인자 내용, 길이)로 실행한다.
+ * 스레드풀을 만든 프로세스에서, 다른 프로세스가 그 종류를 요청하기 전에 불러야 한다.
+ */
+int pthread_pool_shm_register(pthread_pool_t *pool, int type, void (*f)(void *payload, size_t len))
+{
+    if (!(pool->mode & POOL_SHM) || type < 0 || type >= POOL_SHM_MAXTYPE)
+        return POOL_FAIL;
+    pool->types[type] = f;
+    return POOL_SUCCESS;
+}
+
+/*
+ * POOL_SHM 스레드풀 pool에 작업 종류 번호 type과 길이 len인 인자 내용 payload로 작업을 요청한다.
+ * 인자 내용은 공유 메모리의 대기열 칸으로 복사되므로 호출이 끝나면 payload를 다시 써도 된다.
+ * 스레드풀을 만든 프로세스와 pthread_pool_shm_open()으로 붙은 프로세스 모두 부를 수 있으며,
+ * 영역이 붙은 주소가 프로세스마다 다르므로 대기열과 칸은 영역 시작에서의 거리로 찾는다.
+ * flag과 리턴값의 뜻은 pthread_pool_submit()과 같다. len이 POOL_SHM_PAYLOAD보다 크면 POOL_FAIL이다.
+ */
+int pthread_pool_submit_inline(pthread_pool_t *pool, int type, const void *payload, size_t len, int flag)
+{
+    if (!(pool->mode & POOL_SHM) || type < 0 || type >= POOL_SHM_MAXTYPE || len > POOL_SHM_PAYLOAD)
+        return POOL_FAIL;
+
+    struct pool_shm *shm = shm_of(pool);
+    task_t *q = (task_t *)((char *)shm + shm->q_off);
+    struct pool_shm_slot *slot = (struct pool_shm_slot *)((char *)shm + shm->slot_off);
+    uint64_t submit = (pool->mode & POOL_STATS) ? now_ns() : 0;
+
+    pool_lock(pool);
+    while (pool->q_len == pool->q_size && pool->running && flag == POOL_WAIT) {
+        pool_wait(pool, &(pool->empty));
+    }
+    if (!pool->running) {
+        pthread_mutex_unlock(&(pool->mutex));
+        return POOL_FAIL;
+    }
+    if (pool->q_len == pool->q_size) {
+        pthread_mutex_unlock(&(pool->mutex));
+        return POOL_FULL;
+    }
+
+    // 대기열 칸에 종류 번호를, 나란한 칸에 인자 내용을 넣음 (26.10.19)
+    int i = (pool->q_front + pool->q_len) % pool->q_size;
+    q[i].function = NULL;
+    q[i].param = (void *)(intptr_t)type;
+    q[i].expire = NULL;
+    q[i].deadline = POOL_NODEADLINE;
+    q[i].seq = pool->q_seq++;
+    q[i].submit = submit;
+    slot[i].len = len;
+    memcpy(slot[i].data, payload, len);
+    // q_len 을 늘리는 것이 넣기의 마지막 한 걸음이 되게 함, 그 전에 죽으면 칸은 없던 것이 됨 (26.10.19)
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    pool->q_len++;
+
+    pthread_cond_signal(&(pool->full));
+    pthread_mutex_unlock(&(pool->mutex));
+    return POOL_SUCCESS;
+}
+
+/*
+ * 일꾼 스레드별 통계 표를 함수 주소 기준으로 합쳐서 out에 최대 max개까지 담고, 담은 개수를 리턴한다.
+ * 일꾼은 락 없이 계속 기록하므로 결과는 읽는 순간의 근삿값이며, 항목 사이의 합이 정확히 맞지 않을 수 있다.
+ * POOL_STATS 모드가 아니면 0을 리턴한다. 스레드풀을 종료하기 전에만 부를 수 있다.
+ */
+int pthread_pool_stats(pthread_pool_t *pool, pool_stat_t *out, int max)
+{
+    int n = 0;
+
+    if (!(pool->mode & POOL_STATS))
+        return 0;
+
+    // 일꾼과 지금까지 만든 예비 일꾼의 표를 합침, bee_ctx[bee_size] 는 표가 없음 (26.10.19)
+    int nctx = pool->bee_size + 1 + __atomic_load_n(&pool->spare_size, __ATOMIC_ACQUIRE);
+    for (int b = 0; b < nctx; b++) {
+        if (pool->bee_ctx[b].stat == NULL)
+            continue;
+        for (int i = 0; i < POOL_STATSIZE; i++) {
+            struct pool_stat_slot *e = pool->bee_ctx[b].stat + i;
+            uint64_t count = atomic_load_explicit(&e->count, memory_order_relaxed);
+            if (count == 0)
+                continue;
+            // 넘친 칸은 function 을 NULL 로 보고함 (26.10.19)
+            void (*f)(void *) = NULL;
+            if (i != POOL_STATSIZE - 1)
+                f = (void (*)(void *))atomic_load_explicit(&e->key, memory_order_acquire);
+
+            // 같은 함수의 항목이 있으면 합치고, 없으면 새 항목을 만듦
+            int j;
+            for (j = 0; j < n; j++)
+                if (out[j].function == f)
+                    break;
+            if (j == n) {
+                if (n == max)
+                    continue;
+                out[n].function = f;
+                out[n].count = out[n].wait_ns = out[n].run_ns = out[n].cpu_ns = 0;
+                n++;
+            }
+            out[j].count += count;
+            out[j].wait_ns += atomic_load_explicit(&e->wait_ns, memory_order_relaxed);
+            out[j].run_ns += atomic_load_explicit(&e->run_ns, memory_order_relaxed);
+            out[j].cpu_ns += atomic_load_explicit(&e->cpu_ns, memory_order_relaxed);
+        }
+    }
+    return n;
+}
+
+/*
+ * pthread_pool_stats()의 결과를 함수마다 한 줄씩 fp에 출력한다.
+ * 평균 대기 시간, 평균 실행 시간, 평균 CPU 시간은 마이크로초 단위이다.
+ */
+void pthread_pool_stats_dump(pthread_pool_t *pool, FILE *fp)
+{
+    pool_stat_t stat[POOL_STATSIZE];
+    int n = pthread_pool_stats(pool, stat, POOL_STATSIZE);
+
+    fprintf(fp, "%-18s %10s %12s %12s %12s %12s\n", "function", "count", "wait(us)", "run(us)", "cpu(us)", "cpu_total(ms)");
+    for (int i = 0; i < n; i++) {
+        pool_stat_t *e = stat + i;
+        fprintf(fp, "%-18p %10llu %12.2f %12.2f %12.2f %12.2f\n", (void *)e->function, (unsigned long long)e->count,
+                e->wait_ns / 1e3 / e->count, e->run_ns / 1e3 / e->count, e->cpu_ns / 1e3 / e->count, e->cpu_ns / 1e6);
+    }
+}
+
+/*
+ * POOL_TRACE 모드에서 링 버퍼에 쌓인 사건을 Chrome trace-event JSON 형식으로 fp에 출력한다.
+ * 지난 flush 이후의 사건만 내보내며, 링 버퍼가 넘쳐 덮어쓴 사건은 빠진다.
+ * 일꾼마다 tid가 하나씩이고, 일꾼이 아닌 스레드의 작업 요청은 tid가 bee_size인 줄에 모인다.
+ * 예비 일꾼은 그 뒤의 tid를 쓴다.
+ * 작업 실행과 대기(park)는 구간으로, 요청(submit)과 꺼냄(dequeue)은 순간 사건으로 표시한다.
+ * chrome://tracing 이나 Perfetto UI에서 열어 볼 수 있다. 출력한 사건 수를 리턴한다.
+ */
+int pthread_pool_trace_flush(pthread_pool_t *pool, FILE *fp)
+{
+    static const char *name[] = { "submit", "dequeue", "", "", "park", "park" };
+    static const char *phase[] = { "i", "i", "B", "E", "B", "E" };
+    int pid = getpid(), n = 0;
+
+    if (!(pool->mode & POOL_TRACE))
+        return 0;
+
+    fprintf(fp, "{\"traceEvents\":[\n");
+    int nring = pool->bee_size + 1 + __atomic_load_n(&pool->spare_size, __ATOMIC_ACQUIRE);
+    for (int b = 0; b < nring; b++) {
+        fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s %d\"}}",
+                b ? ",\n" : "", pid, b, b < pool->bee_size ? "bee" : b == pool->bee_size ? "submitter" : "spare", b);
+
+        struct pool_trace_ring *r = pool->trace + b;
+        uint64_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+        uint64_t i = r->tail;
+        if (head - i > POOL_TRACESIZE)
+            i = head - POOL_TRACESIZE;
+        for (; i < head; i++) {
+            struct pool_trace_event *e = r->ev + i % POOL_TRACESIZE;
+            // 읽는 도중 덮어쓰였거나 아직 다 쓰이지 않은 칸은 건너뜀 (26.10.19)
+            if (atomic_load_explicit(&e->seq, memory_order_acquire) != i + 1)
+                continue;
+            uint64_t ts = atomic_load_explicit(&e->ts, memory_order_relaxed);
+            uintptr_t fn = atomic_load_explicit(&e->fn, memory_order_relaxed);
+            int type = atomic_load_explicit(&e->type, memory_order_relaxed);
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&e->seq, memory_order_relaxed) != i + 1)
+                continue;
+
+            // 작업 구간은 함수 주소를 이름으로 써서 함수별로 구분되게 함
+            char buf[32];
+            if (type == EV_START || type == EV_END)
+                snprintf(buf, sizeof(buf), "%p", (void *)fn);
+            fprintf(fp, ",\n{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":%d,\"tid\":%d",
+                    type == EV_START || type == EV_END ? buf : name[type], phase[type], ts / 1e3, pid, b);
+            if (phase[type][0] == 'i')
+                fprintf(fp, ",\"s\":\"t\"");
+            if (fn)
+                fprintf(fp, ",\"args\":{\"function\":\"%p\"}", (void *)fn);
+            fprintf(fp, "}");
+            n++;
+        }
+        r->tail = head;
+    }
+    fprintf(fp, "\n]}\n");
+    return n;
+}
@@ -10,6 +10,9 @@
 
 #include <pthread.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
 
 #define POOL_MAXBSIZE 128
 #define POOL_MAXQSIZE 1024
@@ -20,15 +23,101 @@
 #define POOL_FULL 2
 #define POOL_DISCARD 0
 #define POOL_COMPLETE 1
+#define POOL_FIFO 0
+#define POOL_EDF 1
+#define POOL_STATS 2
+#define POOL_STATSIZE 64
+#define POOL_TRACE 4
+#define POOL_TRACESIZE 4096
+#define POOL_SHM 8
+#define POOL_PROC 16
+#define POOL_SHM_PAYLOAD 256
+#define POOL_SHM_MAXTYPE 64
+#define POOL_SHM_NAMELEN 64
+#define POOL_ARENASIZE 65536
+#define POOL_CACHELINE 64
+#define POOL_NODEADLINE UINT64_MAX
+
+/*
+ * 스레드풀 제어블록의 필드 묶음을 캐시 라인 경계에 맞추는 지정자이다.
+ * POOL_PACKED_LAYOUT을 정의하고 빌드하면 맞추지 않은 배치가 되어 둘을 비교할 수 있다.
+ */
+#ifdef POOL_PACKED_LAYOUT
+#define POOL_ALIGNED
+#else
+#define POOL_ALIGNED _Alignas(POOL_CACHELINE)
+#endif
 
 /*
  * 스레드를 통해 실행할 작업 함수와 함수의 인자정보 구조체 타입
+ *
+ * deadline은 CLOCK_MONOTONIC 기준의 절대 마감시각(ns)이며, 마감이 없는 작업은 POOL_NODEADLINE이다.
+ * 대기열에서 꺼낼 때 마감시각이 이미 지났다면 function 대신 expire를 호출하고 작업을 버린다.
+ * seq는 마감시각이 같은 작업끼리 들어온 순서(FIFO)를 유지하기 위한 일련번호이다.
+ * POOL_SHM 스레드풀에 작업 종류 번호와 인자 내용으로 요청한 작업은 function이 NULL이고,
+ * param에 작업 종류 번호가, 대기열과 나란한 공유 메모리 칸에 인자 내용이 들어 있다.
  */
 typedef struct {
     void (*function)(void *param);
     void *param;
+    void (*expire)(void *param);
+    uint64_t deadline;
+    uint64_t seq;
+    uint64_t submit;
 } task_t;
 
+/*
+ * pthread_pool_submit_task()나 pthread_pool_then()으로 요청한 작업의 핸들 타입
+ * 내용은 pthread_pool.c 안에 숨겨져 있으며, 다 쓴 핸들은 pthread_pool_task_release()로 반납한다.
+ */
+typedef struct pool_task pool_task_t;
+
+/*
+ * 작업 함수별로 모은 실행 통계 구조체 타입
+ *
+ * count는 실행된 횟수이고, wait_ns는 작업 요청에서 실행 시작까지 대기열에서 기다린 시간,
+ * run_ns는 실행에 걸린 벽시계 시간, cpu_ns는 CLOCK_THREAD_CPUTIME_ID로 잰 CPU 시간의 합이다.
+ * 표가 넘쳐서 따로 집계하지 못한 함수들은 function이 NULL인 항목 하나로 모인다.
+ */
+typedef struct {
+    void (*function)(void *param);
+    uint64_t count;
+    uint64_t wait_ns;
+    uint64_t run_ns;
+    uint64_t cpu_ns;
+} pool_stat_t;
+
+/*
+ * 일꾼 스레드 하나가 혼자 쓰는 지역 정보 구조체 타입
+ *
+ * id는 스레드풀 안에서의 일꾼 번호로 0부터 bee_size-1까지이다.
+ * stat은 POOL_STATS 모드에서 함수별 통계를 모으는 표이며, 이 일꾼만 갱신하므로 락이 필요 없다.
+ * 읽는 쪽은 pthread_pool_stats()에서 모든 일꾼의 표를 합친다.
+ * deadline은 지금 실행 중인 작업의 마감시각이고, yield_depth는 pthread_pool_yield() 안에서
+ * 실행 중인 작업의 중첩 깊이이다.
+ * next는 방금 끝난 작업의 후속 작업(continuation)을 대기열을 거치지 않고 이 일꾼이 곧바로
+ * 실행하도록 맡겨 두는 자리이며, has_next가 참일 때만 유효하다.
+ * inline_buf는 POOL_SHM에서 대기열에서 꺼낸 인자 내용을 옮겨 두는 곳으로, yield 중첩 깊이마다 하나씩이다.
+ * arena는 pthread_pool_scratch()가 잘라 주는 POOL_ARENASIZE 크기의 임시 메모리로 처음 쓸 때 할당되며,
+ * arena_top은 지금까지 잘라 준 크기이다. 작업 하나가 끝나면 작업을 시작할 때의 값으로 되돌린다.
+ * rng는 pthread_pool_rand()가 쓰는 xoshiro256** 난수 생성기의 상태이다.
+ * blocking은 pthread_pool_blocking_begin() 구간의 중첩 깊이이다.
+ */
+typedef struct pthread_bee {
+    struct pthread_pool *pool;   /* 이 일꾼 스레드가 속한 스레드풀 */
+    int id;                      /* 스레드풀 안에서의 일꾼 번호 */
+    struct pool_stat_slot *stat; /* POOL_STATS일 때 함수별 통계 표 */
+    uint64_t deadline;           /* 실행 중인 작업의 마감시각 */
+    int yield_depth;             /* pthread_pool_yield() 중첩 깊이 */
+    bool has_next;               /* next에 곧바로 실행할 작업이 있는지 여부 */
+    task_t next;                 /* 대기열을 거치지 않고 곧바로 실행할 후속 작업 */
+    struct pool_inline *inline_buf; /* POOL_SHM일 때 꺼낸 작업의 인자 내용 */
+    char *arena;                 /* 작업이 끝나면 비워지는 임시 메모리 */
+    size_t arena_top;            /* arena에서 지금까지 잘라 준 크기 */
+    uint64_t rng[4];             /* xoshiro256** 난수 생성기 상태 */
+    int blocking;                /* blocking 구간 중첩 깊이 */
+} pthread_bee_t;
+
 /*
  * 스레드풀을 운영하는데 필요한 정보를 저장하는 스레드풀 제어블록 구조체 타입
  *
@@ -42,22 +131,90 @@ typedef struct {
  * bee_size는 배열 bee의 크기를 나타내며 일꾼 스레드의 갯수를 의미한다.
  * mutex는 대기열을 조회하거나 변경하기 위해 사용하는 상호배타 락이다.
  * full과 empty는 대기열에 작업이 채워지기를 또는 빈 자리가 생기기를 기다리는 조건 변수이다.
+ * mode는 POOL_EDF, POOL_STATS 등을 OR로 묶은 값이다.
+ * mode에 POOL_EDF가 있으면 q는 원형 버퍼 대신 마감시각이 가장 이른 작업이 q[0]에 오는 4진 힙으로 쓰인다.
+ * q_seq는 다음에 들어올 작업에 매길 일련번호이다.
+ * trace는 POOL_TRACE 모드에서 사건을 기록하는 링 버퍼 배열로, 일꾼마다 하나씩과
+ * 일꾼이 아닌 스레드가 작업을 요청한 사건을 모으는 마지막 하나를 합쳐 bee_size+1개이다.
+ * bee_ctx는 일꾼 스레드마다 하나씩 있는 지역 정보의 배열로 bee와 같은 순서이다.
+ * mode에 POOL_SHM이 있으면 제어블록과 대기열이 공유 메모리에 있어서 다른 프로세스도 작업을 넣을 수 있다.
+ * 이때 mutex와 조건 변수는 프로세스 간 공유 속성으로 초기화되며, types는 작업 종류 번호별 함수 표이다.
+ * mutex는 robust 속성도 가져서 쥔 프로세스가 죽으면 다음에 잡는 쪽이 대기열을 고친 뒤 이어 쓴다.
+ * bee, bee_ctx, trace, types는 스레드풀을 만든 프로세스 안에서만 뜻이 있는 주소이다.
+ * mode에 POOL_PROC도 있으면 일꾼은 fork()로 미리 만든 자식 프로세스이고, bee의 스레드는
+ * 자식 프로세스 하나씩을 지켜보다가 비정상 종료하면 새로 만드는 감독 스레드이다.
+ * blocked는 blocking 구간 안에서 막혀 있는 일꾼의 수이다. 막힌 일꾼만큼 예비 일꾼(spare)을 깨워서
+ * 실제로 일할 수 있는 일꾼의 수를 bee_size 가까이 유지한다. 예비 일꾼은 처음 필요할 때 만들며
+ * 최대 bee_size개이고, 스레드 ID는 bee[bee_size]부터, 지역 정보는 bee_ctx[bee_size+1]부터 놓인다.
+ * bee_ctx[bee_size]는 일꾼이 아닌 스레드의 몫으로 비워 둔다(trace의 번호와 맞추기 위함).
+ * spare_size는 만든 예비 일꾼의 수, spare_active는 그중 일하고 있는 수, spare_wake는 깨우라는 신호를
+ * 받았지만 아직 일어나지 않은 수이며, 쉬는 예비 일꾼은 조건 변수 spare에서 기다린다.
+ *
+ * 필드는 쓰이는 방식에 따라 캐시 라인을 나눠 쓴다. 초기화 뒤로는 읽기만 하는 필드를 한 묶음으로,
+ * mutex와 mutex를 쥔 스레드만 고치는 대기열 위치와 계수를 한 묶음으로 둔다. 락을 쥔 스레드는 어차피
+ * mutex의 라인을 가져오므로 함께 고치는 필드는 같은 라인에 두는 편이 낫다. 요청하는 쪽이 기다리는
+ * empty, 일꾼이 기다리는 full, 예비 일꾼이 기다리는 spare는 각각 따로 둔다. 기다리는 스레드와
+ * 신호하는 스레드가 조건 변수를 고칠 때 락 라인이나 읽기 전용 라인을 무효화하지 않게 하기 위함이다.
  */
-typedef struct {
+typedef struct pthread_pool {
+    // 초기화 뒤로는 읽기만 하는 필드 (running 은 종료할 때 한 번 바뀜)
+    POOL_ALIGNED
     bool running;           /* 스레드풀의 실행 또는 종료 상태 */
     task_t *q;              /* FIFO 작업 대기열로 사용할 원형 버퍼 */
     int q_size;             /* 원형 버퍼 q 배열의 크기 */
-    int q_front;            /* 대기열에서 다음에 실행될 작업의 위치 */
-    int q_len;              /* 대기열의 길이, 0이면 현재 대기하고 있는 작업이 없다는 뜻 */
+    int mode;               /* POOL_EDF, POOL_STATS 등의 조합 */
     pthread_t *bee;         /* 일꾼(일벌) 스레드의 ID를 저장하기 위한 배열 */
     int bee_size;           /* bee 배열의 크기로 일꾼 스레드의 수를 의미 */
+    pthread_bee_t *bee_ctx; /* 일꾼 스레드별 지역 정보 */
+    struct pool_trace_ring *trace; /* POOL_TRACE일 때 사건 기록용 링 버퍼 */
+    uint64_t trace_t0;      /* 사건 시각의 기준점 */
+    void (**types)(void *payload, size_t len); /* POOL_SHM일 때 작업 종류 번호별 함수 */
+
+    // mutex 와 mutex 를 쥐고 고치는 필드
+    POOL_ALIGNED
     pthread_mutex_t mutex;  /* 대기열을 접근하기 위해 사용하는 상호배타 락 */
+    int q_front;            /* 대기열에서 다음에 실행될 작업의 위치 */
+    int q_len;              /* 대기열의 길이, 0이면 현재 대기하고 있는 작업이 없다는 뜻 */
+    uint64_t q_seq;         /* 다음 작업에 매길 일련번호 */
+    int blocked;            /* blocking 구간 안에 있는 일꾼의 수 */
+    int spare_size;         /* 지금까지 만든 예비 일꾼의 수 */
+    int spare_active;       /* 일하고 있는 예비 일꾼의 수 */
+    int spare_wake;         /* 깨우라고 신호했지만 아직 일어나지 않은 예비 일꾼의 수 */
+
+    // 기다리는 쪽마다 따로 둔 조건 변수
+    POOL_ALIGNED
     pthread_cond_t full;    /* 빈 대기열에 새 작업이 들어올 때까지 기다리는 곳 */
+    POOL_ALIGNED
     pthread_cond_t empty;   /* 대기열에 빈 자리가 발생할 때까지 기다리는 곳 */
+    POOL_ALIGNED
+    pthread_cond_t spare;   /* 쉬는 예비 일꾼이 기다리는 곳 */
 } pthread_pool_t;
 
 int pthread_pool_init(pthread_pool_t *pool, size_t bee_size, size_t queue_size);
+int pthread_pool_init_mode(pthread_pool_t *pool, size_t bee_size, size_t queue_size, int mode);
 int pthread_pool_submit(pthread_pool_t *pool, void (*f)(void *p), void *p, int flag);
+int pthread_pool_submit_deadline(pthread_pool_t *pool, void (*f)(void *p), void *p,
+                                 const struct timespec *deadline, void (*expire)(void *p), int flag);
 int pthread_pool_shutdown(pthread_pool_t *pool, int how);
+int pthread_pool_submit_task(pthread_pool_t *pool, void (*f)(void *p), void *p, int flag, pool_task_t **handle);
+int pthread_pool_then(pool_task_t *t, void (*f)(void *p), void *p, pool_task_t **handle);
+bool pthread_pool_task_done(pool_task_t *t);
+void pthread_pool_task_release(pool_task_t *t);
+int pthread_pool_yield(void);
+pthread_bee_t *pthread_pool_self(void);
+void *pthread_pool_scratch(size_t size);
+uint64_t pthread_pool_rand(void);
+void pthread_pool_blocking_begin(void);
+void pthread_pool_blocking_end(void);
+pthread_pool_t *pthread_pool_shm_create(const char *name, size_t bee_size, size_t queue_size);
+pthread_pool_t *pthread_pool_shm_open(const char *name);
+int pthread_pool_shm_close(pthread_pool_t *pool);
+pthread_pool_t *pthread_pool_proc_create(const char *name, size_t proc_size, size_t queue_size);
+int pthread_pool_proc_crashed(pthread_pool_t *pool);
+int pthread_pool_shm_register(pthread_pool_t *pool, int type, void (*f)(void *payload, size_t len));
+int pthread_pool_submit_inline(pthread_pool_t *pool, int type, const void *payload, size_t len, int flag);
+int pthread_pool_stats(pthread_pool_t *pool, pool_stat_t *out, int max);
+void pthread_pool_stats_dump(pthread_pool_t *pool, FILE *fp);
+int pthread_pool_trace_flush(pthread_pool_t *pool, FILE *fp);
 
 #endif